@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `name` = 'server memory';
+INSERT INTO `command` (`name`, `security`, `help`) VALUES
+('server memory', 3, 'Syntax: .server memory\r\n\r\nDisplay allocation statistics of the object pools used for creatures, game objects, items, spells and auras.');
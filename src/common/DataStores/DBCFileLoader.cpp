@@ -20,16 +20,62 @@
 #include <stdio.h>
 #include <string.h>
 
+#if AC_PLATFORM != AC_PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+DBCFileMapping::~DBCFileMapping()
+{
+#if AC_PLATFORM != AC_PLATFORM_WINDOWS
+    if (_data)
+        munmap(_data, _size);
+#endif
+}
+
+bool DBCFileMapping::Map(char const* filename)
+{
+#if AC_PLATFORM != AC_PLATFORM_WINDOWS
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    // private writable mapping: a few stores are patched in place at startup, those pages get copied
+    void* address = mmap(nullptr, fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (address == MAP_FAILED)
+        return false;
+
+    _data = static_cast<unsigned char*>(address);
+    _size = fileStat.st_size;
+    return true;
+#else
+    (void)filename;
+    return false;
+#endif
+}
+
 DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(nullptr), data(nullptr), stringTable(nullptr) { }
 
 bool DBCFileLoader::Load(char const* filename, char const* fmt)
 {
     uint32 header;
-    if (data)
-    {
+    if (mapping)
+        mapping.reset();
+    else
         delete [] data;
-        data = nullptr;
-    }
+
+    data = nullptr;
 
     FILE* f = fopen(filename, "rb");
     if (!f)
@@ -99,6 +145,20 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
         }
     }
 
+    if (IsMappableFormat(fmt))
+    {
+        std::unique_ptr<DBCFileMapping> fileMapping = std::make_unique<DBCFileMapping>();
+        if (fileMapping->Map(filename) && fileMapping->GetSize() >= 20 + recordSize * recordCount + stringSize)
+        {
+            fclose(f);
+
+            mapping = std::move(fileMapping);
+            data = mapping->GetData() + 20;                  // skip header
+            stringTable = data + recordSize * recordCount;
+            return true;
+        }
+    }
+
     data = new unsigned char[recordSize * recordCount + stringSize];
     stringTable = data + recordSize * recordCount;
 
@@ -115,11 +175,30 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
 
 DBCFileLoader::~DBCFileLoader()
 {
-    delete[] data;
+    if (!mapping)
+        delete[] data;
 
     delete[] fieldsOffset;
 }
 
+bool DBCFileLoader::IsMappableFormat(char const* fmt) const
+{
+#if ACORE_ENDIAN == ACORE_LITTLEENDIAN
+    // the file layout must be the C++ structure layout: 4 byte fields only, nothing skipped, no string pointers
+    if (strlen(fmt) != fieldCount || recordSize != fieldCount * sizeof(uint32))
+        return false;
+
+    for (uint32 i = 0; fmt[i]; ++i)
+        if (fmt[i] != FT_INT && fmt[i] != FT_IND && fmt[i] != FT_FLOAT)
+            return false;
+
+    return true;
+#else
+    (void)fmt;
+    return false;
+#endif
+}
+
 DBCFileLoader::Record DBCFileLoader::getRecord(size_t id)
 {
     ASSERT(data);
@@ -274,6 +353,56 @@ char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**
     return dataTable;
 }
 
+std::unique_ptr<DBCFileMapping> DBCFileLoader::AutoProduceMappedData(char const* format, uint32& records, char**& indexTable)
+{
+    typedef char* ptr;
+    if (!mapping || strlen(format) != fieldCount)
+    {
+        return nullptr;
+    }
+
+    int32 i;
+    GetFormatRecordSize(format, &i);
+
+    if (i >= 0)
+    {
+        uint32 maxi = 0;
+        for (uint32 y = 0; y < recordCount; ++y)
+        {
+            uint32 ind = getRecord(y).getUInt(i);
+            if (ind > maxi)
+            {
+                maxi = ind;
+            }
+        }
+
+        ++maxi;
+        records = maxi;
+        indexTable = new ptr[maxi];
+        memset(indexTable, 0, maxi * sizeof(ptr));
+
+        for (uint32 y = 0; y < recordCount; ++y)
+        {
+            indexTable[getRecord(y).getUInt(i)] = reinterpret_cast<char*>(data + y * recordSize);
+        }
+    }
+    else
+    {
+        records = recordCount;
+        indexTable = new ptr[recordCount];
+
+        for (uint32 y = 0; y < recordCount; ++y)
+        {
+            indexTable[y] = reinterpret_cast<char*>(data + y * recordSize);
+        }
+    }
+
+    // records now belong to the caller through the mapping
+    data = nullptr;
+    stringTable = nullptr;
+    return std::move(mapping);
+}
+
 char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
 {
     if (strlen(format) != fieldCount)
@@ -21,6 +21,7 @@
 #include "Define.h"
 #include "Errors.h"
 #include "Utilities/ByteConverter.h"
+#include <memory>
 
 enum DbcFieldFormat
 {
@@ -35,6 +36,27 @@ enum DbcFieldFormat
     FT_LOGIC = 'l'                                           //Logical (boolean)
 };
 
+/// Copy-on-write mapping of a whole .dbc file. Pages that are never written
+/// stay shared with the page cache and with other processes mapping the same file.
+class DBCFileMapping
+{
+public:
+    DBCFileMapping() = default;
+    ~DBCFileMapping();
+
+    bool Map(char const* filename);
+
+    [[nodiscard]] unsigned char* GetData() const { return _data; }
+    [[nodiscard]] size_t GetSize() const { return _size; }
+
+private:
+    unsigned char* _data = nullptr;
+    size_t _size = 0;
+
+    DBCFileMapping(DBCFileMapping const& right) = delete;
+    DBCFileMapping& operator=(DBCFileMapping const& right) = delete;
+};
+
 class DBCFileLoader
 {
 public:
@@ -94,9 +116,14 @@ public:
     [[nodiscard]] bool IsLoaded() const { return data != nullptr; }
     char* AutoProduceData(char const* fmt, uint32& count, char**& indexTable);
     char* AutoProduceStrings(char const* fmt, char* dataTable);
+    /// Builds only the index table when the file was mapped, records are used in place.
+    /// The returned mapping must outlive the index table; returns nullptr when the file was read into memory instead.
+    std::unique_ptr<DBCFileMapping> AutoProduceMappedData(char const* fmt, uint32& count, char**& indexTable);
     static uint32 GetFormatRecordSize(const char* format, int32* index_pos = nullptr);
 
 private:
+    [[nodiscard]] bool IsMappableFormat(char const* fmt) const;
+
     uint32 recordSize;
     uint32 recordCount;
     uint32 fieldCount;
@@ -104,6 +131,7 @@ private:
     uint32* fieldsOffset;
     unsigned char* data;
     unsigned char* stringTable;
+    std::unique_ptr<DBCFileMapping> mapping;
 
     DBCFileLoader(DBCFileLoader const& right) = delete;
     DBCFileLoader& operator=(DBCFileLoader const& right) = delete;
@@ -17,6 +17,7 @@
 
 #include "EventMap.h"
 #include "Random.h"
+#include <algorithm>
 
 void EventMap::Reset()
 {
@@ -65,7 +66,7 @@ void EventMap::ScheduleEvent(uint32 eventId, uint32 time, uint32 group /*= 0*/,
         eventId |= (1 << (phase + 23));
     }
 
-    _eventMap.emplace(_time + time, eventId);
+    Insert(_time + time, eventId);
 }
 
 void EventMap::ScheduleEvent(uint32 eventId, Milliseconds time, uint32 group /*= 0*/, uint8 phase /* = 0*/)
@@ -98,7 +99,7 @@ void EventMap::RescheduleEvent(uint32 eventId, Milliseconds minTime, Millisecond
 
 void EventMap::RepeatEvent(uint32 time)
 {
-    _eventMap.emplace(_time + time, _lastEvent);
+    Insert(_time + time, _lastEvent);
 }
 
 void EventMap::Repeat(Milliseconds time)
@@ -115,22 +116,19 @@ uint32 EventMap::ExecuteEvent()
 {
     while (!Empty())
     {
-        auto const& itr = _eventMap.begin();
+        Event const next = _eventMap.back();
 
-        if (itr->first > _time)
+        if (next.Time > _time)
         {
             return 0;
         }
-        else if (_phase && (itr->second & 0xFF000000) && !((itr->second >> 24) & _phase))
-        {
-            _eventMap.erase(itr);
-        }
-        else
+
+        _eventMap.pop_back();
+
+        if (!_phase || !(next.Data & 0xFF000000) || ((next.Data >> 24) & _phase))
         {
-            uint32 eventId = (itr->second & 0x0000FFFF);
-            _lastEvent = itr->second;
-            _eventMap.erase(itr);
-            return eventId;
+            _lastEvent = next.Data;
+            return (next.Data & 0x0000FFFF);
         }
     }
 
@@ -154,36 +152,50 @@ void EventMap::DelayEvents(uint32 delay, uint32 group)
         return;
     }
 
+    // collected in execution order, so they keep their relative order when queued again
     EventStore delayed;
 
-    for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
     {
-        if (!group || (itr->second & (1 << (group + 15))))
+        if (!group || (itr->Data & (1 << (group + 15))))
         {
-            delayed.insert(EventStore::value_type(itr->first + delay, itr->second));
-            itr = _eventMap.erase(itr);
-            continue;
+            delayed.push_back({ itr->Time + delay, itr->Data });
         }
+    }
 
-        ++itr;
+    if (delayed.empty())
+    {
+        return;
     }
 
-    _eventMap.insert(delayed.begin(), delayed.end());
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), [group](Event const& event)
+    {
+        return !group || (event.Data & (1 << (group + 15)));
+    }), _eventMap.end());
+
+    for (Event const& event : delayed)
+    {
+        Insert(event.Time, event.Data);
+    }
 }
 
 void EventMap::DelayEventsToMax(uint32 delay, uint32 group)
 {
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+    while (true)
     {
-        if (itr->first < _time + delay && (group == 0 || ((1 << (group + 15)) & itr->second)))
+        auto itr = std::find_if(_eventMap.rbegin(), _eventMap.rend(), [this, delay, group](Event const& event)
+        {
+            return event.Time < _time + delay && (group == 0 || ((1 << (group + 15)) & event.Data));
+        });
+
+        if (itr == _eventMap.rend())
         {
-            ScheduleEvent(itr->second, delay);
-            _eventMap.erase(itr);
-            itr = _eventMap.begin();
-            continue;
+            break;
         }
 
-        ++itr;
+        uint32 const data = itr->Data;
+        _eventMap.erase(std::next(itr).base());
+        ScheduleEvent(data, delay);
     }
 }
 
@@ -194,16 +206,10 @@ void EventMap::CancelEvent(uint32 eventId)
         return;
     }
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), [eventId](Event const& event)
     {
-        if (eventId == (itr->second & 0x0000FFFF))
-        {
-            itr = _eventMap.erase(itr);
-            continue;
-        }
-
-        ++itr;
-    }
+        return eventId == (event.Data & 0x0000FFFF);
+    }), _eventMap.end());
 }
 
 void EventMap::CancelEventGroup(uint32 group)
@@ -214,17 +220,10 @@ void EventMap::CancelEventGroup(uint32 group)
     }
 
     uint32 groupMask = (1 << (group + 15));
-    for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), [groupMask](Event const& event)
     {
-        if (itr->second & groupMask)
-        {
-            _eventMap.erase(itr);
-            itr = _eventMap.begin();
-            continue;
-        }
-
-        ++itr;
-    }
+        return event.Data & groupMask;
+    }), _eventMap.end());
 }
 
 uint32 EventMap::GetNextEventTime(uint32 eventId) const
@@ -234,11 +233,11 @@ uint32 EventMap::GetNextEventTime(uint32 eventId) const
         return 0;
     }
 
-    for (auto const& itr : _eventMap)
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
     {
-        if (eventId == (itr.second & 0x0000FFFF))
+        if (eventId == (itr->Data & 0x0000FFFF))
         {
-            return itr.first;
+            return itr->Time;
         }
     }
 
@@ -247,7 +246,7 @@ uint32 EventMap::GetNextEventTime(uint32 eventId) const
 
 uint32 EventMap::GetNextEventTime() const
 {
-    return Empty() ? 0 : _eventMap.begin()->first;
+    return Empty() ? 0 : _eventMap.back().Time;
 }
 
 bool EventMap::IsInPhase(uint8 phase)
@@ -257,9 +256,20 @@ bool EventMap::IsInPhase(uint8 phase)
 
 Milliseconds EventMap::GetTimeUntilEvent(uint32 eventId) const
 {
-    for (std::pair<uint32 const, uint32> const& itr : _eventMap)
-        if (eventId == (itr.second & 0x0000FFFF))
-            return std::chrono::duration_cast<Milliseconds>(Milliseconds(itr.first) - Milliseconds(_time));
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
+        if (eventId == (itr->Data & 0x0000FFFF))
+            return std::chrono::duration_cast<Milliseconds>(Milliseconds(itr->Time) - Milliseconds(_time));
 
     return Milliseconds::max();
 }
+
+void EventMap::Insert(uint32 time, uint32 data)
+{
+    // first event due at or before time, everything in front of it runs later
+    auto itr = std::partition_point(_eventMap.begin(), _eventMap.end(), [time](Event const& event)
+    {
+        return event.Time > time;
+    });
+
+    _eventMap.insert(itr, { time, data });
+}
@@ -20,14 +20,14 @@
 
 #include "Define.h"
 #include "Duration.h"
-#include <map>
+#include <boost/container/small_vector.hpp>
 
 class EventMap
 {
     /**
-    * Internal storage type.
-    * Key: Time as TimePoint when the event should occur.
-    * Value: The event data as uint32.
+    * Internal event type.
+    * Time: Time as TimePoint when the event should occur.
+    * Data: The event data as uint32.
     *
     * Structure of event data:
     * - Bit  0 - 15: Event Id.
@@ -35,7 +35,20 @@ class EventMap
     * - Bit 24 - 31: Phase
     * - Pattern: 0xPPGGEEEE
     */
-    typedef std::multimap<uint32, uint32> EventStore;
+    struct Event
+    {
+        uint32 Time;
+        uint32 Data;
+    };
+
+    /**
+    * Internal storage type.
+    * Sorted by time with the next event at the back, events sharing a time
+    * are stored newest first so they still execute in scheduling order.
+    * Scripts rarely keep more than a handful of events, those never leave
+    * the inline storage.
+    */
+    typedef boost::container::small_vector<Event, 8> EventStore;
 
 public:
     EventMap() { }
@@ -314,9 +327,15 @@ private:
     */
     uint32 _lastEvent{0};
 
+    /**
+    * @name Insert
+    * @brief Queues the event data behind all events due at the same time.
+    */
+    void Insert(uint32 time, uint32 data);
+
     /**
     * @name _eventMap
-    * @brief Internal event storage map. Contains the scheduled events.
+    * @brief Internal event storage. Contains the scheduled events.
     *
     * See typedef at the beginning of the class for more
     * details.
@@ -17,6 +17,7 @@
 
 #include "EventProcessor.h"
 #include "Errors.h"
+#include <algorithm>
 
 void BasicEvent::ScheduleAbort()
 {
@@ -37,18 +38,15 @@ EventProcessor::~EventProcessor()
     KillAllEvents(true);
 }
 
-void EventProcessor::Update(uint32 p_time)
+void EventProcessor::ProcessEvents(uint32 p_time)
 {
-    // update time
-    m_time += p_time;
-
     // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    while (!m_events.empty() && m_events.front().Time <= m_time)
     {
         // get and remove event from queue
-        BasicEvent* event = i->second;
-        m_events.erase(i);
+        std::pop_heap(m_events.begin(), m_events.end(), ScheduledEvent::Later);
+        BasicEvent* event = m_events.back().Event;
+        m_events.pop_back();
 
         if (event->IsRunning())
         {
@@ -82,54 +80,62 @@ void EventProcessor::Update(uint32 p_time)
 void EventProcessor::KillAllEvents(bool force)
 {
     // first, abort all existing events
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    // (indexed, aborting may schedule new events)
+    for (std::size_t i = 0; i < m_events.size(); ++i)
     {
+        BasicEvent* event = m_events[i].Event;
+
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            event->SetAborted();
+            event->Abort(m_time);
         }
+    }
+
+    std::vector<ScheduledEvent> events;
+    events.swap(m_events);
 
+    for (ScheduledEvent const& scheduled : events)
+    {
         // Skip non-deletable events when we are
         // not forcing the event cancellation.
-        if (!force && !itr->second->IsDeletable())
+        if (!force && !scheduled.Event->IsDeletable())
         {
-            ++itr;
+            m_events.push_back(scheduled);
             continue;
         }
 
-        delete itr->second;
-
-        if (force)
-            ++itr; // Clear the whole container when forcing
-        else
-            itr = m_events.erase(itr);
+        delete scheduled.Event;
     }
 
-    if (force)
-        m_events.clear();
+    std::make_heap(m_events.begin(), m_events.end(), ScheduledEvent::Later);
 }
 
 void EventProcessor::CancelEventGroup(uint8 group)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    std::vector<ScheduledEvent> events;
+    events.swap(m_events);
+
+    for (ScheduledEvent const& scheduled : events)
+        if (scheduled.Event->m_eventGroup != group)
+            m_events.push_back(scheduled);
+
+    std::make_heap(m_events.begin(), m_events.end(), ScheduledEvent::Later);
+
+    for (ScheduledEvent const& scheduled : events)
     {
-        if (itr->second->m_eventGroup != group)
-        {
-            ++itr;
+        if (scheduled.Event->m_eventGroup != group)
             continue;
-        }
 
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!scheduled.Event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            scheduled.Event->SetAborted();
+            scheduled.Event->Abort(m_time);
         }
 
-        delete itr->second;
-        itr = m_events.erase(itr);
+        delete scheduled.Event;
     }
 }
 
@@ -139,19 +145,22 @@ void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime
         Event->m_addTime = m_time;
     Event->m_execTime = e_time;
     Event->m_eventGroup = eventGroup;
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time, Event));
+    m_events.push_back({ e_time, m_sequence++, Event });
+    std::push_heap(m_events.begin(), m_events.end(), ScheduledEvent::Later);
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* event, Milliseconds newTime)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
+    for (ScheduledEvent& scheduled : m_events)
     {
-        if (itr->second != event)
+        if (scheduled.Event != event)
             continue;
 
         event->m_execTime = newTime.count();
-        m_events.erase(itr);
-        m_events.insert(std::pair<uint64, BasicEvent*>(newTime.count(), event));
+        // like a fresh insertion, goes after the events already due at that time
+        scheduled.Time = newTime.count();
+        scheduled.Sequence = m_sequence++;
+        std::make_heap(m_events.begin(), m_events.end(), ScheduledEvent::Later);
         break;
     }
 }
@@ -22,8 +22,8 @@
 #include "Duration.h"
 #include "Random.h"
 #include "advstd.h"
-#include <map>
 #include <type_traits>
+#include <vector>
 
 class EventProcessor;
 
@@ -92,15 +92,22 @@ class LambdaBasicEvent : public BasicEvent
 template<typename T>
 using is_lambda_event = std::enable_if_t<!std::is_base_of_v<BasicEvent, std::remove_pointer_t<advstd::remove_cvref_t<T>>>>;
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
-
 class EventProcessor
 {
     public:
         EventProcessor()  = default;
         ~EventProcessor();
 
-        void Update(uint32 p_time);
+        void Update(uint32 p_time)
+        {
+            // update time
+            m_time += p_time;
+
+            // inlined so objects without a due event skip event processing entirely
+            if (!m_events.empty() && m_events.front().Time <= m_time)
+                ProcessEvents(p_time);
+        }
+
         void KillAllEvents(bool force);
         void AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime = true) { AddEvent(Event, e_time, set_addtime, 0); };
         void AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime, uint8 eventGroup);
@@ -124,9 +131,28 @@ class EventProcessor
 
         void CancelEventGroup(uint8 group);
 
+        // execution time of the earliest scheduled event, 0 when nothing is scheduled
+        [[nodiscard]] uint64 GetNextEventTime() const { return m_events.empty() ? 0 : m_events.front().Time; }
+
     protected:
+        struct ScheduledEvent
+        {
+            uint64 Time;
+            uint64 Sequence;
+            BasicEvent* Event;
+
+            // heap order, events due at the same time run in the order they were added
+            static bool Later(ScheduledEvent const& left, ScheduledEvent const& right)
+            {
+                return left.Time != right.Time ? left.Time > right.Time : left.Sequence > right.Sequence;
+            }
+        };
+
+        void ProcessEvents(uint32 p_time);
+
         uint64 m_time{0};
-        EventList m_events;
+        uint64 m_sequence{0};
+        std::vector<ScheduledEvent> m_events;               // binary min heap, see ScheduledEvent::Later
         bool m_aborting;
 };
 
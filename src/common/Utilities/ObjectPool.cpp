@@ -0,0 +1,365 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectPool.h"
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <new>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace
+{
+    // blocks moved between a thread cache and the shared lists at once
+    constexpr uint32 TRANSFER_BATCH = 32;
+    constexpr std::size_t SLAB_SIZE = 64 * 1024;
+
+    std::size_t GetBlockSize(std::size_t bucket)
+    {
+        return (bucket + 1) * ObjectPool::BLOCK_GRANULARITY;
+    }
+
+    // slabs are aligned to their power of two size, so the slab of a block is found by masking its address
+    std::size_t GetSlabSize(std::size_t bucket)
+    {
+        return std::max(SLAB_SIZE, std::bit_ceil(8 * GetBlockSize(bucket)));
+    }
+
+    struct ObjectPoolRegistry
+    {
+        std::mutex Lock;
+        std::vector<ObjectPool*> Pools;
+    };
+
+    ObjectPoolRegistry& GetRegistry()
+    {
+        static ObjectPoolRegistry* registry = new ObjectPoolRegistry();
+        return *registry;
+    }
+
+    void MoveBlock(ObjectPool::FreeList& from, ObjectPool::FreeList& to)
+    {
+        ObjectPool::FreeBlock* block = from.Head;
+        from.Head = block->Next;
+        --from.Count;
+
+        block->Next = to.Head;
+        to.Head = block;
+        ++to.Count;
+    }
+}
+
+struct ObjectPoolThreadCache
+{
+    // hands everything back so the blocks can be reused by other threads
+    void ReleaseAll()
+    {
+        for (uint32 id = 0; id < Lists.size(); ++id)
+        {
+            if (!Lists[id])
+                continue;
+
+            ObjectPool* pool;
+            {
+                ObjectPoolRegistry& registry = GetRegistry();
+                std::lock_guard<std::mutex> guard(registry.Lock);
+                pool = registry.Pools[id];
+            }
+
+            for (std::size_t bucket = 0; bucket < ObjectPool::BUCKET_COUNT; ++bucket)
+                if (Lists[id][bucket].Count)
+                    pool->Release(bucket, Lists[id][bucket], Lists[id][bucket].Count);
+        }
+    }
+
+    // indexed by pool id
+    std::vector<std::unique_ptr<ObjectPool::FreeList[]>> Lists;
+};
+
+// Objects are still freed after thread_local destructors ran (static managers deleting items at exit,
+// namespace scope task schedulers), so the cache itself lives on the heap behind trivially destructible
+// thread_locals. Once a thread is torn down its allocations go straight to the shared lists.
+static thread_local ObjectPoolThreadCache* ThreadCache = nullptr;
+static thread_local bool ThreadCacheTornDown = false;
+
+struct ObjectPoolThreadCacheOwner
+{
+    ~ObjectPoolThreadCacheOwner()
+    {
+        ThreadCacheTornDown = true;
+        if (ThreadCache)
+        {
+            ThreadCache->ReleaseAll();
+            delete ThreadCache;
+            ThreadCache = nullptr;
+        }
+    }
+};
+
+static thread_local ObjectPoolThreadCacheOwner ThreadCacheOwner;
+
+ObjectPool::ObjectPool(std::string name, uint32 id) : _name(std::move(name)), _id(id), _allocations(0), _inUse(0), _reservedBytes(0)
+{
+}
+
+ObjectPool& ObjectPool::Get(std::string_view name)
+{
+    ObjectPoolRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> guard(registry.Lock);
+
+    for (ObjectPool* pool : registry.Pools)
+        if (pool->_name == name)
+            return *pool;
+
+    ObjectPool* pool = new ObjectPool(std::string(name), registry.Pools.size());
+    registry.Pools.push_back(pool);
+    return *pool;
+}
+
+std::vector<ObjectPool::Statistics> ObjectPool::GetAllStatistics()
+{
+    ObjectPoolRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> guard(registry.Lock);
+
+    std::vector<Statistics> statistics;
+    statistics.reserve(registry.Pools.size());
+    for (ObjectPool const* pool : registry.Pools)
+        statistics.push_back(pool->GetStatistics());
+
+    return statistics;
+}
+
+ObjectPool::Statistics ObjectPool::GetStatistics() const
+{
+    return { _name, _allocations.load(std::memory_order_relaxed), _inUse.load(std::memory_order_relaxed), _reservedBytes.load(std::memory_order_relaxed) };
+}
+
+void* ObjectPool::Allocate(std::size_t size)
+{
+    _allocations.fetch_add(1, std::memory_order_relaxed);
+    _inUse.fetch_add(1, std::memory_order_relaxed);
+
+    if (size > MAX_BLOCK_SIZE)
+        return ::operator new(size);
+
+    std::size_t const bucket = (size - 1) / BLOCK_GRANULARITY;
+    FreeList* caches = GetThreadCache();
+    if (!caches)
+    {
+        // thread is exiting, take a batch from the shared list and give back what is left
+        FreeList cache;
+        Refill(bucket, cache);
+
+        FreeBlock* block = cache.Head;
+        cache.Head = block->Next;
+        --cache.Count;
+
+        if (cache.Count)
+            Release(bucket, cache, cache.Count);
+
+        return block;
+    }
+
+    FreeList& cache = caches[bucket];
+    if (!cache.Head)
+        Refill(bucket, cache);
+
+    FreeBlock* block = cache.Head;
+    cache.Head = block->Next;
+    --cache.Count;
+    return block;
+}
+
+void ObjectPool::Deallocate(void* ptr, std::size_t size)
+{
+    if (!ptr)
+        return;
+
+    _inUse.fetch_sub(1, std::memory_order_relaxed);
+
+    if (size > MAX_BLOCK_SIZE)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    std::size_t const bucket = (size - 1) / BLOCK_GRANULARITY;
+    FreeBlock* block = static_cast<FreeBlock*>(ptr);
+
+    FreeList* caches = GetThreadCache();
+    if (!caches)
+    {
+        FreeList single;
+        block->Next = nullptr;
+        single.Head = block;
+        single.Count = 1;
+        Release(bucket, single, 1);
+        return;
+    }
+
+    FreeList& cache = caches[bucket];
+    block->Next = cache.Head;
+    cache.Head = block;
+    ++cache.Count;
+
+    // objects are often freed by another thread than the one that created them (items, update requests),
+    // so caches that only free would grow forever without giving blocks back
+    if (cache.Count >= 2 * TRANSFER_BATCH)
+        Release(bucket, cache, TRANSFER_BATCH);
+}
+
+ObjectPool::FreeList* ObjectPool::GetThreadCache()
+{
+    if (ThreadCacheTornDown)
+        return nullptr;
+
+    if (!ThreadCache)
+    {
+        ThreadCache = new ObjectPoolThreadCache();
+        // first use of the owner registers its destructor for this thread
+        (void)&ThreadCacheOwner;
+    }
+
+    std::vector<std::unique_ptr<FreeList[]>>& lists = ThreadCache->Lists;
+    if (lists.size() <= _id)
+        lists.resize(_id + 1);
+
+    if (!lists[_id])
+        lists[_id] = std::make_unique<FreeList[]>(BUCKET_COUNT);
+
+    return lists[_id].get();
+}
+
+void ObjectPool::Refill(std::size_t bucket, FreeList& cache)
+{
+    {
+        std::lock_guard<std::mutex> guard(_buckets[bucket].Lock);
+        FreeList& shared = _buckets[bucket].Free;
+        while (shared.Head && cache.Count < TRANSFER_BATCH)
+            MoveBlock(shared, cache);
+    }
+
+    if (cache.Head)
+        return;
+
+    std::size_t const blockSize = GetBlockSize(bucket);
+    std::size_t const slabSize = GetSlabSize(bucket);
+    std::size_t const blockCount = slabSize / blockSize;
+    char* slab = static_cast<char*>(::operator new(slabSize, std::align_val_t(slabSize)));
+    _reservedBytes.fetch_add(slabSize, std::memory_order_relaxed);
+
+    FreeList carved;
+    for (std::size_t i = blockCount; i > 0; --i)
+    {
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + (i - 1) * blockSize);
+        block->Next = carved.Head;
+        carved.Head = block;
+        ++carved.Count;
+    }
+
+    // keep one batch, a full slab in the cache would be handed back a batch at a time on every free
+    while (carved.Head && cache.Count < TRANSFER_BATCH)
+        MoveBlock(carved, cache);
+
+    if (carved.Count)
+        Release(bucket, carved, carved.Count);
+}
+
+void ObjectPool::Release(std::size_t bucket, FreeList& cache, uint32 count)
+{
+    std::lock_guard<std::mutex> guard(_buckets[bucket].Lock);
+    FreeList& shared = _buckets[bucket].Free;
+    while (count-- && cache.Head)
+        MoveBlock(cache, shared);
+}
+
+std::size_t ObjectPool::Trim(std::size_t keepFreeBytes)
+{
+    std::size_t released = 0;
+    for (std::size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+    {
+        std::size_t const blockSize = GetBlockSize(bucket);
+        std::size_t const slabSize = GetSlabSize(bucket);
+        uint32 const blocksPerSlab = slabSize / blockSize;
+
+        std::lock_guard<std::mutex> guard(_buckets[bucket].Lock);
+        FreeList& shared = _buckets[bucket].Free;
+        std::size_t freeBytes = std::size_t(shared.Count) * blockSize;
+        if (freeBytes <= keepFreeBytes)
+            continue;
+
+        auto getSlab = [slabSize](FreeBlock const* block) { return reinterpret_cast<std::uintptr_t>(block) & ~(slabSize - 1); };
+
+        std::unordered_map<std::uintptr_t, uint32> freeBlocksBySlab;
+        for (FreeBlock const* block = shared.Head; block; block = block->Next)
+            ++freeBlocksBySlab[getSlab(block)];
+
+        // only slabs whose blocks are all in the shared list can be handed back
+        std::unordered_set<std::uintptr_t> releasedSlabs;
+        for (auto const& [slab, freeBlocks] : freeBlocksBySlab)
+        {
+            if (freeBytes <= keepFreeBytes)
+                break;
+
+            if (freeBlocks == blocksPerSlab)
+            {
+                releasedSlabs.insert(slab);
+                freeBytes -= slabSize;
+            }
+        }
+
+        if (releasedSlabs.empty())
+            continue;
+
+        FreeBlock** link = &shared.Head;
+        while (*link)
+        {
+            if (releasedSlabs.count(getSlab(*link)))
+            {
+                *link = (*link)->Next;
+                --shared.Count;
+            }
+            else
+                link = &(*link)->Next;
+        }
+
+        for (std::uintptr_t slab : releasedSlabs)
+            ::operator delete(reinterpret_cast<void*>(slab), std::align_val_t(slabSize));
+
+        _reservedBytes.fetch_sub(releasedSlabs.size() * slabSize, std::memory_order_relaxed);
+        released += releasedSlabs.size() * slabSize;
+    }
+
+    return released;
+}
+
+std::size_t ObjectPool::TrimAll(std::size_t keepFreeBytes)
+{
+    std::vector<ObjectPool*> pools;
+    {
+        ObjectPoolRegistry& registry = GetRegistry();
+        std::lock_guard<std::mutex> guard(registry.Lock);
+        pools = registry.Pools;
+    }
+
+    std::size_t released = 0;
+    for (ObjectPool* pool : pools)
+        released += pool->Trim(keepFreeBytes);
+
+    return released;
+}
@@ -0,0 +1,144 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _OBJECT_POOL_H_
+#define _OBJECT_POOL_H_
+
+#include "Define.h"
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// Size bucketed free list allocator for objects created and destroyed at high rates
+/// (creatures, game objects, items, spells, auras). Every thread keeps a small cache per
+/// bucket so map threads do not contend with each other, surplus blocks move to the shared
+/// lists in batches. Freed memory is kept for reuse until Trim hands the slabs that are
+/// entirely in the shared lists back to the system allocator.
+///
+/// Classes opt in with OBJECT_POOL_ALLOCATED(name) in their class body.
+class AC_COMMON_API ObjectPool
+{
+public:
+    struct Statistics
+    {
+        std::string Name;
+        uint64 Allocations;     // total number of allocations served
+        uint64 InUse;           // blocks currently handed out
+        uint64 ReservedBytes;   // memory taken from the system allocator
+    };
+
+    /// Returns the pool registered under name, creating it on first use.
+    /// Pools live until the process ends, objects may still be deleted by static destructors at exit.
+    static ObjectPool& Get(std::string_view name);
+
+    static std::vector<Statistics> GetAllStatistics();
+
+    /// Trim on every pool, returns the number of bytes released
+    static std::size_t TrimAll(std::size_t keepFreeBytes);
+
+    void* Allocate(std::size_t size);
+    void Deallocate(void* ptr, std::size_t size);
+
+    [[nodiscard]] Statistics GetStatistics() const;
+
+    /// Releases completely free slabs of each block size while more than keepFreeBytes of it are
+    /// free in the shared lists, returns the number of bytes released. Blocks held by thread caches
+    /// keep their slab. Locks each block size while walking its free list, so call it rarely.
+    std::size_t Trim(std::size_t keepFreeBytes);
+
+    struct FreeBlock
+    {
+        FreeBlock* Next;
+    };
+
+    struct FreeList
+    {
+        FreeBlock* Head = nullptr;
+        uint32 Count = 0;
+    };
+
+    static constexpr std::size_t BLOCK_GRANULARITY = 64;
+    static constexpr std::size_t MAX_BLOCK_SIZE = 16 * 1024;
+    static constexpr std::size_t BUCKET_COUNT = MAX_BLOCK_SIZE / BLOCK_GRANULARITY;
+
+private:
+    friend struct ObjectPoolThreadCache;
+
+    ObjectPool(std::string name, uint32 id);
+
+    ObjectPool(ObjectPool const&) = delete;
+    ObjectPool& operator=(ObjectPool const&) = delete;
+
+    FreeList* GetThreadCache();
+    void Refill(std::size_t bucket, FreeList& cache);
+    void Release(std::size_t bucket, FreeList& cache, uint32 count);
+
+    struct Bucket
+    {
+        std::mutex Lock;
+        FreeList Free;
+    };
+
+    std::string _name;
+    uint32 _id;
+    std::array<Bucket, BUCKET_COUNT> _buckets;
+
+    std::atomic<uint64> _allocations;
+    std::atomic<uint64> _inUse;
+    std::atomic<uint64> _reservedBytes;
+};
+
+/// Standard allocator drawing from an ObjectPool, e.g. for std::allocate_shared.
+template<class T>
+class ObjectPoolAllocator
+{
+    template<class U> friend class ObjectPoolAllocator;
+
+public:
+    typedef T value_type;
+
+    explicit ObjectPoolAllocator(ObjectPool& pool) : _pool(&pool) { }
+    template<class U> ObjectPoolAllocator(ObjectPoolAllocator<U> const& other) : _pool(other._pool) { }
+
+    T* allocate(std::size_t count) { return static_cast<T*>(_pool->Allocate(count * sizeof(T))); }
+    void deallocate(T* ptr, std::size_t count) { _pool->Deallocate(ptr, count * sizeof(T)); }
+
+    template<class U> bool operator==(ObjectPoolAllocator<U> const& other) const { return _pool == other._pool; }
+    template<class U> bool operator!=(ObjectPoolAllocator<U> const& other) const { return _pool != other._pool; }
+
+private:
+    ObjectPool* _pool;
+};
+
+/// Class level operator new/delete drawing from the named pool, for the class and everything derived from it.
+/// The sized operator delete is required: derived classes use larger buckets.
+#define OBJECT_POOL_ALLOCATED(poolName)                                 \
+    static void* operator new(std::size_t size)                         \
+    {                                                                   \
+        static ObjectPool& pool = ObjectPool::Get(poolName);            \
+        return pool.Allocate(size);                                     \
+    }                                                                   \
+    static void operator delete(void* ptr, std::size_t size)            \
+    {                                                                   \
+        static ObjectPool& pool = ObjectPool::Get(poolName);            \
+        pool.Deallocate(ptr, size);                                     \
+    }
+
+#endif
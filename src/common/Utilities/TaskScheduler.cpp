@@ -61,6 +61,12 @@ TaskScheduler& TaskScheduler::InsertTask(TaskContainer task)
     return *this;
 }
 
+ObjectPoolAllocator<TaskScheduler::Task> TaskScheduler::GetTaskAllocator()
+{
+    static ObjectPool& pool = ObjectPool::Get("TaskScheduler");
+    return ObjectPoolAllocator<Task>(pool);
+}
+
 void TaskScheduler::Dispatch(success_t const& callback)
 {
     // If the validation failed abort the dispatching here.
@@ -114,19 +120,22 @@ bool TaskScheduler::IsGroupScheduled(group_t const group)
 
 void TaskScheduler::TaskQueue::Push(TaskContainer&& task)
 {
-    container.insert(task);
+    task->_sequence = sequence++;
+    container.push_back(std::move(task));
+    std::push_heap(container.begin(), container.end(), Later);
 }
 
 auto TaskScheduler::TaskQueue::Pop() -> TaskContainer
 {
-    TaskContainer result = *container.begin();
-    container.erase(container.begin());
+    std::pop_heap(container.begin(), container.end(), Later);
+    TaskContainer result = std::move(container.back());
+    container.pop_back();
     return result;
 }
 
 auto TaskScheduler::TaskQueue::First() const -> TaskContainer const&
 {
-    return *container.begin();
+    return container.front();
 }
 
 void TaskScheduler::TaskQueue::Clear()
@@ -136,32 +145,35 @@ void TaskScheduler::TaskQueue::Clear()
 
 void TaskScheduler::TaskQueue::RemoveIf(std::function<bool(TaskContainer const&)> const& filter)
 {
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-        {
-            itr = container.erase(itr);
-        }
-        else
-        {
-            ++itr;
-        }
+    auto const removed = std::remove_if(container.begin(), container.end(), filter);
+    if (removed == container.end())
+        return;
+
+    container.erase(removed, container.end());
+    std::make_heap(container.begin(), container.end(), Later);
 }
 
 void TaskScheduler::TaskQueue::ModifyIf(std::function<bool(TaskContainer const&)> const& filter)
 {
-    std::vector<TaskContainer> cache;
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-        {
-            cache.push_back(*itr);
-            itr = container.erase(itr);
-        }
-        else
+    // A sorted container is a valid heap, sorting first keeps the order in which
+    // modified tasks are queued behind tasks that end at the same time.
+    std::sort(container.begin(), container.end(), [](TaskContainer const& left, TaskContainer const& right)
+    {
+        return Later(right, left);
+    });
+
+    bool modified = false;
+    for (TaskContainer const& task : container)
+    {
+        if (filter(task))
         {
-            ++itr;
+            task->_sequence = sequence++;
+            modified = true;
         }
+    }
 
-    container.insert(cache.begin(), cache.end());
+    if (modified)
+        std::make_heap(container.begin(), container.end(), Later);
 }
 
 bool TaskScheduler::TaskQueue::IsGroupQueued(group_t const group)
@@ -182,16 +194,6 @@ bool TaskScheduler::TaskQueue::IsEmpty() const
     return container.empty();
 }
 
-TaskContext& TaskContext::Dispatch(std::function<TaskScheduler&(TaskScheduler&)> const& apply)
-{
-    if (auto const owner = _owner.lock())
-    {
-        apply(*owner);
-    }
-
-    return *this;
-}
-
 bool TaskContext::IsExpired() const
 {
     return _owner.expired();
@@ -243,7 +245,8 @@ void TaskContext::AssertOnConsumed() const
 {
     // This was adapted to TC to prevent static analysis tools from complaining.
     // If you encounter this assertion check if you repeat a TaskContext more then 1 time!
-    ASSERT(!(*_consumed) && "Bad task logic, task context was consumed already!");
+    // A context kept from an earlier invocation was consumed by the Repeat that led to the current one.
+    ASSERT(_task && _invocation == _task->_invocation && !_task->_consumed && "Bad task logic, task context was consumed already!");
 }
 
 void TaskContext::Invoke()
@@ -6,6 +6,7 @@
 #ifndef _TASK_SCHEDULER_H_
 #define _TASK_SCHEDULER_H_
 
+#include "ObjectPool.h"
 #include "Util.h"
 #include <algorithm>
 #include <chrono>
@@ -62,6 +63,12 @@ class TaskScheduler
         std::optional<group_t> _group;
         repeated_t _repeated;
         task_handler_t _task;
+        // insertion order, tasks ending at the same time run in the order they were queued
+        uint64 _sequence{0};
+        // counts the invocations, contexts of an earlier invocation must not touch the task anymore
+        uint32 _invocation{0};
+        // set once the current invocation repeated the task
+        bool _consumed{false};
 
     public:
         // All Argument construct
@@ -109,17 +116,17 @@ class TaskScheduler
     typedef std::shared_ptr<Task> TaskContainer;
 
     /// Container which provides Task order, insert and reschedule operations.
-    struct Compare
-    {
-        bool operator() (TaskContainer const& left, TaskContainer const& right) const
-        {
-            return (*left.get()) < (*right.get());
-        };
-    };
-
+    /// Tasks are kept in a binary min heap ordered by end and insertion sequence.
     class TaskQueue
     {
-        std::multiset<TaskContainer, Compare> container;
+        std::vector<TaskContainer> container;
+        uint64 sequence = 0;
+
+        // Heap order, the task that ends first is on top
+        static bool Later(TaskContainer const& left, TaskContainer const& right)
+        {
+            return left->_end != right->_end ? left->_end > right->_end : left->_sequence > right->_sequence;
+        }
 
     public:
         // Pushes the task in the container
@@ -368,11 +375,14 @@ private:
     /// Insert a new task to the enqueued tasks.
     TaskScheduler& InsertTask(TaskContainer task);
 
+    /// Tasks and their shared_ptr control blocks come from a pool, scripts create and drop them all the time
+    static ObjectPoolAllocator<Task> GetTaskAllocator();
+
     template<class _Rep, class _Period>
     TaskScheduler& ScheduleAt(timepoint_t const& end,
                               std::chrono::duration<_Rep, _Period> const& time, task_handler_t const& task)
     {
-        return InsertTask(TaskContainer(new Task(end + time, time, task)));
+        return InsertTask(std::allocate_shared<Task>(GetTaskAllocator(), end + time, time, task));
     }
 
     /// Schedule an event with a fixed rate.
@@ -383,7 +393,7 @@ private:
                               group_t const group, task_handler_t const& task)
     {
         static repeated_t const DEFAULT_REPEATED = 0;
-        return InsertTask(TaskContainer(new Task(end + time, time, group, DEFAULT_REPEATED, task)));
+        return InsertTask(std::allocate_shared<Task>(GetTaskAllocator(), end + time, time, group, DEFAULT_REPEATED, task));
     }
 
     // Returns a random duration between min and max
@@ -412,35 +422,48 @@ class TaskContext
     /// Owner
     std::weak_ptr<TaskScheduler> _owner;
 
-    /// Marks the task as consumed
-    std::shared_ptr<bool> _consumed;
+    /// Invocation of the task this context was created for
+    uint32 _invocation;
 
     /// Dispatches an action safe on the TaskScheduler
-    TaskContext& Dispatch(std::function<TaskScheduler&(TaskScheduler&)> const& apply);
+    template<typename Apply>
+    TaskContext& Dispatch(Apply const& apply)
+    {
+        if (auto const owner = _owner.lock())
+        {
+            apply(*owner);
+        }
+
+        return *this;
+    }
 
 public:
     // Empty constructor
     TaskContext()
-        : _task(), _owner(), _consumed(std::make_shared<bool>(true)) { }
+        : _task(), _owner(), _invocation(0) { }
 
     // Construct from task and owner
     explicit TaskContext(TaskScheduler::TaskContainer&& task, std::weak_ptr<TaskScheduler>&& owner)
-        : _task(task), _owner(owner), _consumed(std::make_shared<bool>(false)) { }
+        : _task(std::move(task)), _owner(std::move(owner))
+    {
+        _invocation = ++_task->_invocation;
+        _task->_consumed = false;
+    }
 
     // Copy construct
     TaskContext(TaskContext const& right)
-        : _task(right._task), _owner(right._owner), _consumed(right._consumed) { }
+        : _task(right._task), _owner(right._owner), _invocation(right._invocation) { }
 
     // Move construct
     TaskContext(TaskContext&& right)
-        : _task(std::move(right._task)), _owner(std::move(right._owner)), _consumed(std::move(right._consumed)) { }
+        : _task(std::move(right._task)), _owner(std::move(right._owner)), _invocation(right._invocation) { }
 
     // Copy assign
     TaskContext& operator= (TaskContext const& right)
     {
         _task = right._task;
         _owner = right._owner;
-        _consumed = right._consumed;
+        _invocation = right._invocation;
         return *this;
     }
 
@@ -449,7 +472,7 @@ public:
     {
         _task = std::move(right._task);
         _owner = std::move(right._owner);
-        _consumed = std::move(right._consumed);
+        _invocation = right._invocation;
         return *this;
     }
 
@@ -481,8 +504,11 @@ public:
         _task->_duration = duration;
         _task->_end += duration;
         _task->_repeated += 1;
-        (*_consumed) = true;
-        return Dispatch(std::bind(&TaskScheduler::InsertTask, std::placeholders::_1, _task));
+        _task->_consumed = true;
+        return Dispatch([this](TaskScheduler& scheduler) -> TaskScheduler&
+        {
+            return scheduler.InsertTask(_task);
+        });
     }
 
     /// Repeats the event with the same duration.
@@ -437,6 +437,10 @@ public:
     {
         return m_list.size();
     }
+    [[nodiscard]] bool empty() const
+    {
+        return m_list.empty();
+    }
     ListIterator begin()
     {
         return m_list.begin();
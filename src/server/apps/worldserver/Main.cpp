@@ -26,6 +26,7 @@
 #include "Banner.h"
 #include "BattlegroundMgr.h"
 #include "BigNumber.h"
+#include "ChannelMgr.h"
 #include "CliRunnable.h"
 #include "Common.h"
 #include "Config.h"
@@ -39,8 +40,10 @@
 #include "ModuleMgr.h"
 #include "ModulesScriptLoader.h"
 #include "MySQLThreading.h"
+#include "ObjectPool.h"
 #include "OpenSSLCrypto.h"
 #include "OutdoorPvPMgr.h"
+#include "PacketBroadcast.h"
 #include "ProcessPriority.h"
 #include "RASession.h"
 #include "RealmList.h"
@@ -291,6 +294,28 @@ int main(int argc, char** argv)
         METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+
+        for (ObjectPool::Statistics const& pool : ObjectPool::GetAllStatistics())
+        {
+            METRIC_VALUE("object_pool_in_use", pool.InUse, METRIC_TAG("pool", pool.Name));
+            METRIC_VALUE("object_pool_reserved", pool.ReservedBytes, METRIC_TAG("pool", pool.Name));
+        }
+
+        for (PacketBroadcast::Statistics const& broadcast : PacketBroadcast::CollectStatistics())
+        {
+            METRIC_VALUE("broadcast_messages", broadcast.Broadcasts, METRIC_TAG("source", broadcast.Source));
+            METRIC_VALUE("broadcast_recipients", broadcast.Recipients, METRIC_TAG("source", broadcast.Source));
+            METRIC_VALUE("broadcast_max_recipients", broadcast.MaxRecipients, METRIC_TAG("source", broadcast.Source));
+        }
+
+        for (ChannelMgr::ChannelStatistics const& channel : ChannelMgr::CollectStatistics())
+        {
+            std::string team = std::to_string(channel.Team);
+            METRIC_VALUE("channel_messages_queued", channel.Outbound.Queued, METRIC_TAG("channel", channel.Name), METRIC_TAG("team", team));
+            METRIC_VALUE("channel_messages_delivered", channel.Outbound.Delivered, METRIC_TAG("channel", channel.Name), METRIC_TAG("team", team));
+            METRIC_VALUE("channel_messages_dropped", channel.Outbound.Dropped, METRIC_TAG("channel", channel.Name), METRIC_TAG("team", team));
+            METRIC_VALUE("channel_queue_max_size", channel.Outbound.MaxQueueSize, METRIC_TAG("channel", channel.Name), METRIC_TAG("team", team));
+        }
     });
 
     METRIC_EVENT("events", "Worldserver started", "");
@@ -715,46 +740,7 @@ void AuctionListingRunnable()
     LOG_INFO("server", "Starting up Auction House Listing thread...");
 
     while (!World::IsStopped())
-    {
-        Milliseconds diff = AsyncAuctionListingMgr::GetDiff();
-        AsyncAuctionListingMgr::ResetDiff();
-
-        if (!AsyncAuctionListingMgr::GetTempList().empty() || !AsyncAuctionListingMgr::GetList().empty())
-        {
-            {
-                std::lock_guard<std::mutex> guard(AsyncAuctionListingMgr::GetTempLock());
-
-                for (auto const& delayEvent: AsyncAuctionListingMgr::GetTempList())
-                    AsyncAuctionListingMgr::GetList().emplace_back(delayEvent);
-
-                AsyncAuctionListingMgr::GetTempList().clear();
-            }
-
-            for (auto& itr: AsyncAuctionListingMgr::GetList())
-            {
-                if (itr._pickupTimer <= diff)
-                {
-                    itr._pickupTimer = Milliseconds::zero();
-                }
-                else
-                {
-                    itr._pickupTimer -= diff;
-                }
-            }
-
-            for (auto itr = AsyncAuctionListingMgr::GetList().begin(); itr != AsyncAuctionListingMgr::GetList().end(); ++itr)
-            {
-                if ((*itr)._pickupTimer != Milliseconds::zero())
-                    continue;
-
-                if ((*itr).Execute())
-                    AsyncAuctionListingMgr::GetList().erase(itr);
-
-                break;
-            }
-        }
-        std::this_thread::sleep_for(1ms);
-    }
+        AsyncAuctionListingMgr::ProcessSearches(100ms);
 
     LOG_INFO("server", "Auction House Listing thread exiting without problems.");
 }
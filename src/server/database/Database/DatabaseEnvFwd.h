@@ -84,6 +84,8 @@ using WorldDatabaseQueryHolder = SQLQueryHolder<WorldDatabaseConnection>;
 
 class SQLQueryHolderCallback;
 
+class MySQLConnection;
+
 // mysql
 struct MySQLHandle;
 struct MySQLResult;
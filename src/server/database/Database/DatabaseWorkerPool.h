@@ -124,6 +124,12 @@ public:
         return Query(Acore::StringFormatFmt(sql, std::forward<Args>(args)...));
     }
 
+    //! Directly executes an SQL query in string format, reading rows from the server as they are fetched
+    //! instead of buffering the whole result first. Meant for loaders walking huge tables once.
+    //! The connection stays locked until the last row was read or the result is released, so the caller
+    //! must not issue other synchronous queries on this pool while iterating unless more synch connections exist.
+    QueryResult StreamQuery(std::string_view sql);
+
     //! Directly executes an SQL query in prepared format that will block the calling thread until finished.
     //! Returns reference counted auto pointer, no need for manual memory management in upper level code.
     //! Statement must be prepared with CONNECTION_SYNCH flag.
@@ -326,7 +326,24 @@ ResultSet* MySQLConnection::Query(std::string_view sql)
     return new ResultSet(result, fields, rowCount, fieldCount);
 }
 
-bool MySQLConnection::_Query(std::string_view sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount)
+ResultSet* MySQLConnection::StreamQuery(std::string_view sql)
+{
+    if (sql.empty())
+        return nullptr;
+
+    MySQLResult* result = nullptr;
+    MySQLField* fields = nullptr;
+    uint64 rowCount = 0;
+    uint32 fieldCount = 0;
+
+    if (!_Query(sql, &result, &fields, &rowCount, &fieldCount, true))
+        return nullptr;
+
+    // the connection stays busy until every row was read, the result set unlocks it when done
+    return new ResultSet(result, fields, rowCount, fieldCount, this);
+}
+
+bool MySQLConnection::_Query(std::string_view sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount, bool stream /*= false*/)
 {
     if (!m_Mysql)
         return false;
@@ -341,22 +358,23 @@ bool MySQLConnection::_Query(std::string_view sql, MySQLResult** pResult, MySQLF
             LOG_ERROR("sql.sql", "[{}] {}", lErrno, mysql_error(m_Mysql));
 
             if (_HandleMySQLErrno(lErrno)) // If it returns true, an error was handled successfully (i.e. reconnection)
-                return _Query(sql, pResult, pFields, pRowCount, pFieldCount);    // We try again
+                return _Query(sql, pResult, pFields, pRowCount, pFieldCount, stream);    // We try again
 
             return false;
         }
         else
             LOG_DEBUG("sql.sql", "[{} ms] SQL: {}", getMSTimeDiff(_s, getMSTime()), sql);
 
-        *pResult = reinterpret_cast<MySQLResult*>(mysql_store_result(m_Mysql));
-        *pRowCount = mysql_affected_rows(m_Mysql);
+        // streamed results are fetched row by row from the server, the row count is unknown until the end
+        *pResult = reinterpret_cast<MySQLResult*>(stream ? mysql_use_result(m_Mysql) : mysql_store_result(m_Mysql));
+        *pRowCount = stream ? 0 : mysql_affected_rows(m_Mysql);
         *pFieldCount = mysql_field_count(m_Mysql);
     }
 
     if (!*pResult)
         return false;
 
-    if (!*pRowCount)
+    if (!stream && !*pRowCount)
     {
         mysql_free_result(*pResult);
         return false;
@@ -58,6 +58,7 @@ template <class T>
 friend class DatabaseWorkerPool;
 
 friend class PingOperation;
+friend class ResultSet;
 
 public:
     MySQLConnection(MySQLConnectionInfo& connInfo);                               //! Constructor for synchronous connections.
@@ -72,8 +73,9 @@ public:
     bool Execute(std::string_view sql);
     bool Execute(PreparedStatementBase* stmt);
     ResultSet* Query(std::string_view sql);
+    ResultSet* StreamQuery(std::string_view sql);
     PreparedResultSet* Query(PreparedStatementBase* stmt);
-    bool _Query(std::string_view sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount);
+    bool _Query(std::string_view sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount, bool stream = false);
     bool _Query(PreparedStatementBase* stmt, MySQLPreparedStatement** mysqlStmt, MySQLResult** pResult, uint64* pRowCount, uint32* pFieldCount);
 
     void BeginTransaction();
@@ -19,6 +19,7 @@
 #include "Errors.h"
 #include "Field.h"
 #include "Log.h"
+#include "MySQLConnection.h"
 #include "MySQLHacks.h"
 #include "MySQLWorkaround.h"
 
@@ -164,11 +165,12 @@ namespace
     }
 }
 
-ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount) :
+ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount, MySQLConnection* streamConnection) :
     _rowCount(rowCount),
     _fieldCount(fieldCount),
     _result(result),
-    _fields(fields)
+    _fields(fields),
+    _streamConnection(streamConnection)
 {
     _fieldMetadata.resize(_fieldCount);
     _currentRow = new Field[_fieldCount];
@@ -195,6 +197,12 @@ bool ResultSet::NextRow()
     row = mysql_fetch_row(_result);
     if (!row)
     {
+        // a streamed result reads rows from the connection, no row can also mean the read failed.
+        // mysql_fetch_row detaches _result->handle once the stream ends, the error is only kept on the connection
+        if (_streamConnection)
+            if (uint32 errNo = _streamConnection->GetLastError())
+                ABORT("Streamed query result ended early, error {}: {}. Refusing to continue with a partial result.", errNo, mysql_error(_streamConnection->m_Mysql));
+
         CleanUp();
         return false;
     }
@@ -232,6 +240,12 @@ void ResultSet::CleanUp()
         mysql_free_result(_result);
         _result = nullptr;
     }
+
+    if (_streamConnection)
+    {
+        _streamConnection->Unlock();
+        _streamConnection = nullptr;
+    }
 }
 
 Field const& ResultSet::operator[](std::size_t index) const
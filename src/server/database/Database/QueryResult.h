@@ -48,10 +48,11 @@ private:
 class AC_DATABASE_API ResultSet
 {
 public:
-    ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount);
+    ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount, MySQLConnection* streamConnection = nullptr);
     ~ResultSet();
 
     bool NextRow();
+    /// Always 0 for streamed results, rows are only known once they are read
     [[nodiscard]] uint64 GetRowCount() const { return _rowCount; }
     [[nodiscard]] uint32 GetFieldCount() const { return _fieldCount; }
     [[nodiscard]] std::string GetFieldName(uint32 index) const;
@@ -90,6 +91,7 @@ private:
 
     MySQLResult* _result;
     MySQLField* _fields;
+    MySQLConnection* _streamConnection;  ///< Connection locked until all rows of a streamed result are read
 
     ResultSet(ResultSet const& right) = delete;
     ResultSet& operator=(ResultSet const& right) = delete;
@@ -34,10 +34,15 @@
 
 constexpr auto AH_MINIMUM_DEPOSIT = 100;
 
+// how stale the auction data seen by searches may get while auctions keep changing
+constexpr Milliseconds AUCTION_LISTING_SNAPSHOT_INTERVAL = 1s;
+// names of items no longer listed are never looked up again, start over once this many are cached
+constexpr std::size_t AUCTION_SEARCH_NAME_CACHE_SIZE = 20000;
+
 // Proof of concept, we should shift the info we're obtaining in here into AuctionEntry probably
-static bool SortAuction(AuctionEntry* left, AuctionEntry* right, AuctionSortOrderVector& sortOrder, Player* player, bool checkMinBidBuyout)
+static bool SortAuction(AuctionEntry const* left, AuctionEntry const* right, AuctionSortOrderVector const& sortOrder, LocaleConstant locale, bool checkMinBidBuyout)
 {
-    for (auto& thisOrder : sortOrder)
+    for (auto const& thisOrder : sortOrder)
     {
         switch (thisOrder.sortOrder)
         {
@@ -91,12 +96,6 @@ static bool SortAuction(AuctionEntry* left, AuctionEntry* right, AuctionSortOrde
                     continue;
                 }
 
-                LocaleConstant locale = LOCALE_enUS;
-                if (player && player->GetSession())
-                {
-                    locale = player->GetSession()->GetSessionDbLocaleIndex();
-                }
-
                 if (locale > LOCALE_enUS)
                 {
                     if (ItemLocale const* leftIl = sObjectMgr->GetItemLocale(protoLeft->ItemId))
@@ -633,6 +632,8 @@ void AuctionHouseObject::AddAuction(AuctionEntry* auction)
     ASSERT(auction);
 
     _auctionsMap[auction->Id] = auction;
+    UpdateListingEntry(auction);
+
     sScriptMgr->OnAuctionAdd(this, auction);
 }
 
@@ -640,6 +641,9 @@ bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction)
 {
     bool wasInMap = !!_auctionsMap.erase(auction->Id);
 
+    _listingEntries.erase(auction->Id);
+    _listingDirty = true;
+
     sScriptMgr->OnAuctionRemove(this, auction);
 
     // we need to delete the entry, it is not referenced any more
@@ -649,6 +653,57 @@ bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction)
     return wasInMap;
 }
 
+void AuctionHouseObject::UpdateListingEntry(AuctionEntry const* auction)
+{
+    _listingDirty = true;
+
+    Item* item = sAuctionMgr->GetAItem(auction->item_guid);
+    if (!item || !item->GetTemplate())
+    {
+        _listingEntries.erase(auction->Id);
+        return;
+    }
+
+    std::shared_ptr<AuctionListingEntry> entry = std::make_shared<AuctionListingEntry>();
+    entry->Auction = *auction;
+    entry->Proto = item->GetTemplate();
+
+    for (uint8 i = 0; i < MAX_INSPECTED_ENCHANTMENT_SLOT; ++i)
+    {
+        entry->Enchantments[i][0] = item->GetEnchantmentId(EnchantmentSlot(i));
+        entry->Enchantments[i][1] = item->GetEnchantmentDuration(EnchantmentSlot(i));
+        entry->Enchantments[i][2] = item->GetEnchantmentCharges(EnchantmentSlot(i));
+    }
+
+    entry->RandomPropertyId = item->GetItemRandomPropertyId();
+    entry->SuffixFactor = item->GetItemSuffixFactor();
+    entry->Count = item->GetCount();
+    entry->SpellCharges = item->GetSpellCharges();
+
+    _listingEntries[auction->Id] = std::move(entry);
+}
+
+std::shared_ptr<AuctionHouseSnapshot const> AuctionHouseObject::GetListingSnapshot()
+{
+    Milliseconds now = GameTime::GetGameTimeMS();
+    if (_listingSnapshot && (!_listingDirty || GetMSTimeDiff(_listingSnapshotTime, now) < AUCTION_LISTING_SNAPSHOT_INTERVAL))
+        return _listingSnapshot;
+
+    // entries are shared with the previous snapshots, only the views are rebuilt
+    std::shared_ptr<AuctionHouseSnapshot> snapshot = std::make_shared<AuctionHouseSnapshot>();
+    snapshot->Auctions.reserve(_listingEntries.size());
+    for (auto const& [id, entry] : _listingEntries)
+    {
+        snapshot->Auctions.push_back(entry);
+        snapshot->AuctionsByCategory[MakeCategoryKey(entry->Proto->Class, entry->Proto->SubClass)].push_back(entry.get());
+    }
+
+    _listingSnapshot = std::move(snapshot);
+    _listingSnapshotTime = now;
+    _listingDirty = false;
+    return _listingSnapshot;
+}
+
 void AuctionHouseObject::Update()
 {
     time_t checkTime = GameTime::GetGameTime().count() + 60;
@@ -724,159 +779,124 @@ void AuctionHouseObject::BuildListOwnerItems(WorldPacket& data, Player* player,
     }
 }
 
-bool AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player,
-        std::wstring const& wsearchedname, uint32 listfrom, uint8 levelmin, uint8 levelmax, uint8 usable,
+bool AuctionHouseObject::BuildListAuctionItems(AuctionHouseSnapshot const& snapshot, std::vector<AuctionListingEntry const*>& auctionShortlist,
+        std::wstring const& wsearchedname, uint32 listfrom, uint8 levelmin, uint8 levelmax,
         uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality,
-        uint32& count, uint32& totalcount, uint8 /*getAll*/, AuctionSortOrderVector const& sortOrder, Milliseconds searchTimeout)
+        LocaleConstant locale, LocaleConstant dbcLocale, bool sortAll, AuctionSortOrderVector const& sortOrder, Milliseconds searchTimeout)
 {
     uint32 itrcounter = 0;
+    Milliseconds const searchStart = GetTimeMS();
 
     // Ensures that listfrom is not greater that auctions count
-    listfrom = std::min(listfrom, static_cast<uint32>(GetAuctions().size()));
-
-    std::vector<AuctionEntry*> auctionShortlist;
+    listfrom = std::min(listfrom, static_cast<uint32>(snapshot.Auctions.size()));
 
     // pussywizard: optimization, this is a simplified case
-    if (itemClass == 0xffffffff && itemSubClass == 0xffffffff && inventoryType == 0xffffffff && quality == 0xffffffff && levelmin == 0x00 && levelmax == 0x00 && usable == 0x00 && wsearchedname.empty())
+    if (itemClass == 0xffffffff && itemSubClass == 0xffffffff && inventoryType == 0xffffffff && quality == 0xffffffff && levelmin == 0x00 && levelmax == 0x00 && wsearchedname.empty())
     {
-        auto itr = GetAuctionsBegin();
-        for (; itr != GetAuctionsEnd(); ++itr)
+        auctionShortlist.reserve(snapshot.Auctions.size());
+        for (auto const& entry : snapshot.Auctions)
         {
-            auctionShortlist.push_back(itr->second);
+            auctionShortlist.push_back(entry.get());
         }
     }
     else
     {
         auto curTime = GameTime::GetGameTime();
 
-        int loc_idx = player->GetSession()->GetSessionDbLocaleIndex();
-        int locdbc_idx = player->GetSession()->GetSessionDbcLocale();
-
-        for (AuctionEntryMap::const_iterator itr = _auctionsMap.begin(); itr != _auctionsMap.end(); ++itr)
+        auto scanAuctions = [&](auto const& auctions) -> bool
         {
-            if ((itrcounter++) % 100 == 0) // check condition every 100 iterations
+            for (auto const& auction : auctions)
             {
-                if (GetMSTimeDiff(GameTime::GetGameTimeMS(), GetTimeMS()) >= searchTimeout) // pussywizard: stop immediately if diff is high or waiting too long
+                if ((itrcounter++) % 100 == 0) // check condition every 100 iterations
                 {
-                    return false;
+                    if (GetMSTimeDiff(searchStart, GetTimeMS()) >= searchTimeout) // pussywizard: stop immediately if waiting too long
+                    {
+                        return false;
+                    }
                 }
-            }
 
-            AuctionEntry* Aentry = itr->second;
-            // Skip expired auctions
-            if (Aentry->expire_time < curTime.count())
-            {
-                continue;
-            }
-
-            Item* item = sAuctionMgr->GetAItem(Aentry->item_guid);
-            if (!item)
-            {
-                continue;
-            }
-
-            ItemTemplate const* proto = item->GetTemplate();
-            if (itemClass != 0xffffffff && proto->Class != itemClass)
-            {
-                continue;
-            }
-
-            if (itemSubClass != 0xffffffff && proto->SubClass != itemSubClass)
-            {
-                continue;
-            }
-
-            if (inventoryType != 0xffffffff && proto->InventoryType != inventoryType)
-            {
-                // xinef: exception, robes are counted as chests
-                if (inventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
+                AuctionListingEntry const* Aentry = &*auction;
+                // Skip expired auctions
+                if (Aentry->Auction.expire_time < curTime.count())
                 {
                     continue;
                 }
-            }
-
-            if (quality != 0xffffffff && proto->Quality < quality)
-            {
-                continue;
-            }
 
-            if (levelmin != 0x00 && (proto->RequiredLevel < levelmin || (levelmax != 0x00 && proto->RequiredLevel > levelmax)))
-            {
-                continue;
-            }
-
-            if (usable != 0x00)
-            {
-                if (player->CanUseItem(item) != EQUIP_ERR_OK)
+                ItemTemplate const* proto = Aentry->Proto;
+                if (itemClass != 0xffffffff && proto->Class != itemClass)
                 {
                     continue;
                 }
 
-                // xinef: check already learded recipes and pets
-                if (proto->Spells[1].SpellTrigger == ITEM_SPELLTRIGGER_LEARN_SPELL_ID && player->HasSpell(proto->Spells[1].SpellId))
+                if (itemSubClass != 0xffffffff && proto->SubClass != itemSubClass)
                 {
                     continue;
                 }
-            }
 
-            // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
-            // No need to do any of this if no search term was entered
-            if (!wsearchedname.empty())
-            {
-                std::string name = proto->Name1;
-                if (name.empty())
+                if (inventoryType != 0xffffffff && proto->InventoryType != inventoryType)
                 {
-                    continue;
+                    // xinef: exception, robes are counted as chests
+                    if (inventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
+                    {
+                        continue;
+                    }
                 }
 
-                // local name
-                if (loc_idx >= 0)
-                    if (ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId))
-                        ObjectMgr::GetLocaleString(il->Name, loc_idx, name);
-
-                // DO NOT use GetItemEnchantMod(proto->RandomProperty) as it may return a result
-                //  that matches the search but it may not equal item->GetItemRandomPropertyId()
-                //  used in BuildAuctionInfo() which then causes wrong items to be listed
-                int32 propRefID = item->GetItemRandomPropertyId();
-
-                if (propRefID)
+                if (quality != 0xffffffff && proto->Quality < quality)
                 {
-                    // Append the suffix to the name (ie: of the Monkey) if one exists
-                    // These are found in ItemRandomSuffix.dbc and ItemRandomProperties.dbc
-                    // even though the DBC name seems misleading
-                    std::array<char const*, 16> const* suffix = nullptr;
+                    continue;
+                }
 
-                    if (propRefID < 0)
-                    {
-                        ItemRandomSuffixEntry const* itemRandEntry = sItemRandomSuffixStore.LookupEntry(-item->GetItemRandomPropertyId());
-                        if (itemRandEntry)
-                            suffix = &itemRandEntry->Name;
-                    }
-                    else
-                    {
-                        ItemRandomPropertiesEntry const* itemRandEntry = sItemRandomPropertiesStore.LookupEntry(item->GetItemRandomPropertyId());
-                        if (itemRandEntry)
-                            suffix = &itemRandEntry->Name;
-                    }
+                if (levelmin != 0x00 && (proto->RequiredLevel < levelmin || (levelmax != 0x00 && proto->RequiredLevel > levelmax)))
+                {
+                    continue;
+                }
 
-                    // dbc local name
-                    if (suffix)
+                // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
+                // No need to do any of this if no search term was entered
+                if (!wsearchedname.empty())
+                {
+                    std::wstring const& name = GetSearchName(Aentry, locale, dbcLocale);
+                    if (name.empty() || name.find(wsearchedname) == std::wstring::npos)
                     {
-                        // Append the suffix (ie: of the Monkey) to the name using localization
-                        // or default enUS if localization is invalid
-                        name += ' ';
-                        name += (*suffix)[locdbc_idx >= 0 ? locdbc_idx : LOCALE_enUS];
+                        continue;
                     }
                 }
 
-                // Perform the search (with or without suffix)
-                if (!Utf8FitTo(name, wsearchedname))
+                auctionShortlist.push_back(Aentry);
+            }
+
+            return true;
+        };
+
+        if (itemClass == 0xffffffff)
+        {
+            if (!scanAuctions(snapshot.Auctions))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            // only visit the buckets of the requested class (and subclass)
+            auto begin = snapshot.AuctionsByCategory.lower_bound(MakeCategoryKey(itemClass, itemSubClass != 0xffffffff ? itemSubClass : 0));
+            auto end = itemSubClass != 0xffffffff ? snapshot.AuctionsByCategory.upper_bound(MakeCategoryKey(itemClass, itemSubClass))
+                                                  : snapshot.AuctionsByCategory.lower_bound(MakeCategoryKey(itemClass + 1, 0));
+
+            uint32 buckets = 0;
+            for (auto itr = begin; itr != end; ++itr, ++buckets)
+            {
+                if (!scanAuctions(itr->second))
                 {
-                    continue;
+                    return false;
                 }
             }
 
-            auctionShortlist.push_back(Aentry);
+            // keep the auction id order of a full scan, it is what unsorted listings show
+            if (buckets > 1)
+            {
+                std::sort(auctionShortlist.begin(), auctionShortlist.end(), [](AuctionListingEntry const* left, AuctionListingEntry const* right) { return left->Auction.Id < right->Auction.Id; });
+            }
         }
     }
 
@@ -891,38 +911,113 @@ bool AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player
         AuctionSortInfo const& sortInfo = *sortOrder.begin();
         if (sortInfo.sortOrder >= AUCTION_SORT_MINLEVEL && sortInfo.sortOrder < AUCTION_SORT_MAX && sortInfo.sortOrder != AUCTION_SORT_UNK4)
         {
+            bool const checkMinBidBuyout = sortInfo.sortOrder == AUCTION_SORT_BID;
+            auto sortAuction = [&](AuctionListingEntry const* left, AuctionListingEntry const* right)
+            {
+                return SortAuction(&left->Auction, &right->Auction, sortOrder, locale, checkMinBidBuyout);
+            };
+
             // Partial sort to improve performance a bit, but the last pages will burn
-            if (listfrom + 50 <= auctionShortlist.size())
+            if (!sortAll && listfrom + 50 <= auctionShortlist.size())
             {
-                std::partial_sort(auctionShortlist.begin(), auctionShortlist.begin() + listfrom + 50, auctionShortlist.end(),
-                    std::bind(SortAuction, std::placeholders::_1, std::placeholders::_2, sortOrder, player, sortInfo.sortOrder == AUCTION_SORT_BID));
+                std::partial_sort(auctionShortlist.begin(), auctionShortlist.begin() + listfrom + 50, auctionShortlist.end(), sortAuction);
             }
             else
             {
-                std::sort(auctionShortlist.begin(), auctionShortlist.end(), std::bind(SortAuction, std::placeholders::_1, std::placeholders::_2, sortOrder,
-                    player, sortInfo.sortOrder == AUCTION_SORT_BID));
+                std::sort(auctionShortlist.begin(), auctionShortlist.end(), sortAuction);
             }
         }
     }
 
-    for (auto& auction : auctionShortlist)
+    return true;
+}
+
+void AuctionHouseObject::BuildListAuctionPage(WorldPacket& data, std::vector<AuctionListingEntry const*> const& shortlist, uint32 listfrom, AuctionUsableFilter const* usableFor, uint32& count, uint32& totalcount)
+{
+    for (AuctionListingEntry const* auction : shortlist)
     {
+        if (usableFor && !usableFor->CanUse(auction->Proto))
+        {
+            continue;
+        }
+
         // Add the item if no search term or if entered search term was found
         if (count < 50 && totalcount >= listfrom)
         {
-            Item* item = sAuctionMgr->GetAItem(auction->item_guid);
-            if (!item)
-            {
-                continue;
-            }
-
             ++count;
             auction->BuildAuctionInfo(data);
         }
         ++totalcount;
     }
+}
 
-    return true;
+std::wstring const& AuctionHouseObject::GetSearchName(AuctionListingEntry const* entry, LocaleConstant loc_idx, LocaleConstant locdbc_idx)
+{
+    ItemTemplate const* proto = entry->Proto;
+
+    // DO NOT use GetItemEnchantMod(proto->RandomProperty) as it may return a result
+    //  that matches the search but it may not equal item->GetItemRandomPropertyId()
+    //  used in BuildAuctionInfo() which then causes wrong items to be listed
+    int32 propRefID = entry->RandomPropertyId;
+
+    // item entry, random property/suffix and both session locales fully determine the name
+    uint64 key = uint64(proto->ItemId) | (uint64(uint16(propRefID)) << 32) | (uint64(uint8(loc_idx)) << 48) | (uint64(uint8(locdbc_idx)) << 56);
+
+    auto itr = _searchNameCache.find(key);
+    if (itr != _searchNameCache.end())
+        return itr->second;
+
+    // names returned earlier are not kept by the caller across calls, so dropping them here is safe
+    if (_searchNameCache.size() >= AUCTION_SEARCH_NAME_CACHE_SIZE)
+        _searchNameCache.clear();
+
+    std::wstring& wname = _searchNameCache[key];
+
+    std::string name = proto->Name1;
+    if (name.empty())
+        return wname;
+
+    // local name
+    if (loc_idx >= 0)
+        if (ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId))
+            ObjectMgr::GetLocaleString(il->Name, loc_idx, name);
+
+    if (propRefID)
+    {
+        // Append the suffix to the name (ie: of the Monkey) if one exists
+        // These are found in ItemRandomSuffix.dbc and ItemRandomProperties.dbc
+        // even though the DBC name seems misleading
+        std::array<char const*, 16> const* suffix = nullptr;
+
+        if (propRefID < 0)
+        {
+            ItemRandomSuffixEntry const* itemRandEntry = sItemRandomSuffixStore.LookupEntry(-propRefID);
+            if (itemRandEntry)
+                suffix = &itemRandEntry->Name;
+        }
+        else
+        {
+            ItemRandomPropertiesEntry const* itemRandEntry = sItemRandomPropertiesStore.LookupEntry(propRefID);
+            if (itemRandEntry)
+                suffix = &itemRandEntry->Name;
+        }
+
+        // dbc local name
+        if (suffix)
+        {
+            // Append the suffix (ie: of the Monkey) to the name using localization
+            // or default enUS if localization is invalid
+            name += ' ';
+            name += (*suffix)[locdbc_idx >= 0 ? locdbc_idx : LOCALE_enUS];
+        }
+    }
+
+    if (Utf8toWStr(name, wname))
+        wstrToLower(wname);
+    else
+        wname.clear();
+
+    return wname;
 }
 
 //this function inserts to WorldPacket auction's data
@@ -960,6 +1055,32 @@ bool AuctionEntry::BuildAuctionInfo(WorldPacket& data) const
     return true;
 }
 
+void AuctionListingEntry::BuildAuctionInfo(WorldPacket& data) const
+{
+    data << uint32(Auction.Id);
+    data << uint32(Proto->ItemId);
+
+    for (uint8 i = 0; i < MAX_INSPECTED_ENCHANTMENT_SLOT; ++i)
+    {
+        data << uint32(Enchantments[i][0]);
+        data << uint32(Enchantments[i][1]);
+        data << uint32(Enchantments[i][2]);
+    }
+
+    data << int32(RandomPropertyId);
+    data << uint32(SuffixFactor);
+    data << uint32(Count);
+    data << uint32(SpellCharges);
+    data << uint32(0);
+    data << Auction.owner;
+    data << uint32(Auction.startbid);
+    data << uint32(Auction.bid ? Auction.GetAuctionOutBid() : 0);
+    data << uint32(Auction.buyout);
+    data << uint32((Auction.expire_time - GameTime::GetGameTime().count()) * IN_MILLISECONDS);
+    data << Auction.bidder;
+    data << uint32(Auction.bid);
+}
+
 uint32 AuctionEntry::GetAuctionCut() const
 {
     int32 cut = int32(CalculatePct(bid, auctionHouseEntry->cutPercent) * sWorld->getRate(RATE_AUCTION_CUT));
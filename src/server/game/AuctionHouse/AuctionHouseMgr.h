@@ -24,10 +24,15 @@
 #include "EventProcessor.h"
 #include "ObjectGuid.h"
 #include "WorldPacket.h"
+#include <map>
+#include <memory>
 #include <unordered_map>
 
 class Item;
 class Player;
+struct AuctionHouseSnapshot;
+struct AuctionListingEntry;
+struct AuctionUsableFilter;
 
 #define MIN_AUCTION_TIME (12*HOUR)
 #define MAX_AUCTION_ITEMS 160
@@ -155,18 +160,46 @@ public:
 
     bool RemoveAuction(AuctionEntry* auction);
 
+    // must be called after the bid data of a listed auction changed, so searches see the new values
+    void UpdateListingEntry(AuctionEntry const* auction);
+
     void Update();
 
     void BuildListBidderItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount);
     void BuildListOwnerItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount);
-    bool BuildListAuctionItems(WorldPacket& data, Player* player,
-                               std::wstring const& searchedname, uint32 listfrom, uint8 levelmin, uint8 levelmax, uint8 usable,
+
+    /// Read only copy of the auctions for the listing thread, rebuilt at most every AUCTION_LISTING_SNAPSHOT_INTERVAL.
+    /// World thread only, the returned snapshot itself may be used from any thread.
+    std::shared_ptr<AuctionHouseSnapshot const> GetListingSnapshot();
+
+    /// Runs on the listing thread, fills shortlist with the matching auctions of snapshot in client order.
+    /// The whole shortlist is sorted if sortAll is set, otherwise only up to the page starting at listfrom.
+    /// Returns false when the search took longer than searchTimeout.
+    bool BuildListAuctionItems(AuctionHouseSnapshot const& snapshot, std::vector<AuctionListingEntry const*>& shortlist,
+                               std::wstring const& searchedname, uint32 listfrom, uint8 levelmin, uint8 levelmax,
                                uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality,
-                               uint32& count, uint32& totalcount, uint8 getAll, AuctionSortOrderVector const& sortOrder, Milliseconds searchTimeout);
+                               LocaleConstant locale, LocaleConstant dbcLocale, bool sortAll, AuctionSortOrderVector const& sortOrder, Milliseconds searchTimeout);
+
+    /// Writes the page starting at listfrom, when usableFor is set only auctions it allows are counted
+    static void BuildListAuctionPage(WorldPacket& data, std::vector<AuctionListingEntry const*> const& shortlist, uint32 listfrom, AuctionUsableFilter const* usableFor, uint32& count, uint32& totalcount);
 
 private:
+    static uint32 MakeCategoryKey(uint32 itemClass, uint32 itemSubClass) { return (itemClass << 16) | itemSubClass; }
+
+    std::wstring const& GetSearchName(AuctionListingEntry const* entry, LocaleConstant locale, LocaleConstant dbcLocale);
+
     AuctionEntryMap _auctionsMap;
 
+    // listing copies of _auctionsMap, an entry is replaced (never modified) when its auction changes
+    std::map<uint32, std::shared_ptr<AuctionListingEntry const>> _listingEntries;
+    std::shared_ptr<AuctionHouseSnapshot const> _listingSnapshot;
+    Milliseconds _listingSnapshotTime = Milliseconds::zero();
+    bool _listingDirty = true;
+
+    // lowercase localized names (random suffix included) for name searches, only used by the listing thread.
+    // Cleared when it reaches AUCTION_SEARCH_NAME_CACHE_SIZE entries.
+    std::unordered_map<uint64, std::wstring> _searchNameCache;
+
     // storage for "next" auction item for next Update()
     AuctionEntryMap::const_iterator _next;
 };
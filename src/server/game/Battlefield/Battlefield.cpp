@@ -443,26 +443,29 @@ void Battlefield::TeamCastSpell(TeamId team, int32 spellId)
 
 void Battlefield::BroadcastPacketToZone(WorldPacket const* data) const
 {
+    LazySharedWorldPacket sharedData(data);
     for (uint8 team = 0; team < PVP_TEAMS_COUNT; ++team)
         for (GuidUnorderedSet::const_iterator itr = m_players[team].begin(); itr != m_players[team].end(); ++itr)
             if (Player* player = ObjectAccessor::FindPlayer(*itr))
-                player->GetSession()->SendPacket(data);
+                player->GetSession()->SendPacket(sharedData.Get());
 }
 
 void Battlefield::BroadcastPacketToQueue(WorldPacket const* data) const
 {
+    LazySharedWorldPacket sharedData(data);
     for (uint8 team = 0; team < PVP_TEAMS_COUNT; ++team)
         for (GuidUnorderedSet::const_iterator itr = m_PlayersInQueue[team].begin(); itr != m_PlayersInQueue[team].end(); ++itr)
             if (Player* player = ObjectAccessor::FindPlayer(*itr))
-                player->GetSession()->SendPacket(data);
+                player->GetSession()->SendPacket(sharedData.Get());
 }
 
 void Battlefield::BroadcastPacketToWar(WorldPacket const* data) const
 {
+    LazySharedWorldPacket sharedData(data);
     for (uint8 team = 0; team < PVP_TEAMS_COUNT; ++team)
         for (GuidUnorderedSet::const_iterator itr = m_PlayersInWar[team].begin(); itr != m_PlayersInWar[team].end(); ++itr)
             if (Player* player = ObjectAccessor::FindPlayer(*itr))
-                player->GetSession()->SendPacket(data);
+                player->GetSession()->SendPacket(sharedData.Get());
 }
 
 void Battlefield::SendWarning(uint8 id, WorldObject const* target /*= nullptr*/)
@@ -189,7 +189,7 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* group, Battle
     }
 
     //add GroupInfo to m_QueuedGroups
-    m_QueuedGroups[bracketId][index].push_back(ginfo);
+    AddGroupToQueue(ginfo);
 
     // announce world (this doesn't need mutex)
     SendJoinMessageArenaQueue(leader, ginfo, bracketEntry, isRated);
@@ -337,6 +337,20 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     if (groupInfo->Players.empty())
     {
         m_QueuedGroups[_bracketId][_groupType].erase(group_itr);
+
+        if (groupInfo->IsRated)
+        {
+            auto bounds = m_RatedTeamsByRating[_bracketId].equal_range(groupInfo->ArenaMatchmakerRating);
+            for (auto ratingItr = bounds.first; ratingItr != bounds.second; ++ratingItr)
+            {
+                if (ratingItr->second == groupInfo)
+                {
+                    m_RatedTeamsByRating[_bracketId].erase(ratingItr);
+                    break;
+                }
+            }
+        }
+
         delete groupInfo;
         return;
     }
@@ -820,39 +834,6 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
     // check if can start new rated arenas (can create many in single queue update)
     else if (bg_template->isArena())
     {
-        // found out the minimum and maximum ratings the newly added team should battle against
-        // arenaRating is the rating of the latest joined team, or 0
-        // 0 is on (automatic update call) and we must set it to team's with longest wait time
-        if (!arenaRating)
-        {
-            GroupQueueInfo* front1 = nullptr;
-            GroupQueueInfo* front2 = nullptr;
-
-            if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].empty())
-            {
-                front1 = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].front();
-                arenaRating = front1->ArenaMatchmakerRating;
-            }
-
-            if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].empty())
-            {
-                front2 = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].front();
-                arenaRating = front2->ArenaMatchmakerRating;
-            }
-
-            if (front1 && front2)
-            {
-                if (front1->JoinTime < front2->JoinTime)
-                    arenaRating = front1->ArenaMatchmakerRating;
-            }
-            else if (!front1 && !front2)
-                return; // queues are empty
-        }
-
-        //set rating range
-        uint32 arenaMinRating = (arenaRating <= sBattlegroundMgr->GetMaxRatingDifference()) ? 0 : arenaRating - sBattlegroundMgr->GetMaxRatingDifference();
-        uint32 arenaMaxRating = arenaRating + sBattlegroundMgr->GetMaxRatingDifference();
-
         // if max rating difference is set and the time past since server startup is greater than the rating discard time
         // (after what time the ratings aren't taken into account when making teams) then
         // the discard time is current_time - time_to_discard, teams that joined after that, will have their ratings taken into account
@@ -863,58 +844,15 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
         // timer for previous opponents
         int32 discardOpponentsTime = GameTime::GetGameTimeMS().count() - sWorld->getIntConfig(CONFIG_ARENA_PREV_OPPONENTS_DISCARD_TIMER);
 
-        // we need to find 2 teams which will play next game
-        GroupsQueueType::iterator itr_teams[PVP_TEAMS_COUNT];
-        uint8 found = 0;
-        uint8 team = 0;
-
-        for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; i++)
-        {
-            // take the group that joined first
-            GroupsQueueType::iterator itr2 = m_QueuedGroups[bracket_id][i].begin();
-            for (; itr2 != m_QueuedGroups[bracket_id][i].end(); ++itr2)
-            {
-                // if group match conditions, then add it to pool
-                if (!(*itr2)->IsInvitedToBGInstanceGUID
-                    && (((*itr2)->ArenaMatchmakerRating >= arenaMinRating && (*itr2)->ArenaMatchmakerRating <= arenaMaxRating)
-                        || (int32)(*itr2)->JoinTime < discardTime))
-                {
-                    itr_teams[found++] = itr2;
-                    team = i;
-                    break;
-                }
-            }
-        }
-
-        if (!found)
-            return;
-
-        if (found == 1)
+        // returns false if the arena could not be created
+        auto startRatedArena = [&](GroupQueueInfo* aTeam, GroupQueueInfo* hTeam) -> bool
         {
-            for (GroupsQueueType::iterator itr3 = itr_teams[0]; itr3 != m_QueuedGroups[bracket_id][team].end(); ++itr3)
-            {
-                if (!(*itr3)->IsInvitedToBGInstanceGUID
-                    && (((*itr3)->ArenaMatchmakerRating >= arenaMinRating && (*itr3)->ArenaMatchmakerRating <= arenaMaxRating) || (int32)(*itr3)->JoinTime < discardTime)
-                    && ((*(itr_teams[0]))->ArenaTeamId != (*itr3)->PreviousOpponentsTeamId || ((int32)(*itr3)->JoinTime < discardOpponentsTime))
-                    && (*(itr_teams[0]))->ArenaTeamId != (*itr3)->ArenaTeamId)
-                {
-                    itr_teams[found++] = itr3;
-                    break;
-                }
-            }
-        }
-
-        //if we have 2 teams, then start new arena and invite players!
-        if (found == 2)
-        {
-            GroupQueueInfo* aTeam = *(itr_teams[TEAM_ALLIANCE]);
-            GroupQueueInfo* hTeam = *(itr_teams[TEAM_HORDE]);
-
+            //if we have 2 teams, then start new arena and invite players!
             Battleground* arena = sBattlegroundMgr->CreateNewBattleground(bgTypeId, bracketEntry, arenaType, true);
             if (!arena)
             {
                 LOG_ERROR("bg.battleground", "BattlegroundQueue::Update couldn't create arena instance for rated arena match!");
-                return;
+                return false;
             }
 
             aTeam->OpponentsTeamRating = hTeam->ArenaTeamRating;
@@ -926,18 +864,18 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
             LOG_DEBUG("bg.battleground", "setting oposite teamrating for team {} to {}", hTeam->ArenaTeamId, hTeam->OpponentsTeamRating);
 
             // now we must move team if we changed its faction to another faction queue, because then we will spam log by errors in Queue::RemovePlayer
-            if (aTeam->teamId != TEAM_ALLIANCE)
+            if (aTeam->GroupType != BG_QUEUE_PREMADE_ALLIANCE)
             {
+                m_QueuedGroups[bracket_id][aTeam->GroupType].remove(aTeam);
                 aTeam->GroupType = BG_QUEUE_PREMADE_ALLIANCE;
                 m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].push_front(aTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].erase(itr_teams[TEAM_ALLIANCE]);
             }
 
-            if (hTeam->teamId != TEAM_HORDE)
+            if (hTeam->GroupType != BG_QUEUE_PREMADE_HORDE)
             {
+                m_QueuedGroups[bracket_id][hTeam->GroupType].remove(hTeam);
                 hTeam->GroupType = BG_QUEUE_PREMADE_HORDE;
                 m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].push_front(hTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].erase(itr_teams[TEAM_HORDE]);
             }
 
             arena->SetArenaMatchmakerRating(TEAM_ALLIANCE, aTeam->ArenaMatchmakerRating);
@@ -947,8 +885,134 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
 
             LOG_DEBUG("bg.battleground", "Starting rated arena match!");
             arena->StartBattleground();
+            return true;
+        };
+
+        StartRatedArenas(bracket_id, arenaRating, sBattlegroundMgr->GetMaxRatingDifference(), discardTime, discardOpponentsTime, startRatedArena);
+    }
+}
+
+void BattlegroundQueue::AddGroupToQueue(GroupQueueInfo* ginfo)
+{
+    m_QueuedGroups[ginfo->BracketId][ginfo->GroupType].push_back(ginfo);
+
+    if (ginfo->IsRated)
+        m_RatedTeamsByRating[ginfo->BracketId].emplace(ginfo->ArenaMatchmakerRating, ginfo);
+}
+
+void BattlegroundQueue::StartRatedArenas(BattlegroundBracketId bracket_id, uint32 arenaRating, uint32 maxRatingDifference, int32 discardTime, int32 discardOpponentsTime,
+    std::function<bool(GroupQueueInfo*, GroupQueueInfo*)> const& startArena)
+{
+    auto tryRating = [&](uint32 rating) -> bool
+    {
+        GroupQueueInfo* aTeam = nullptr;
+        GroupQueueInfo* hTeam = nullptr;
+        if (!FindRatedArenaMatch(bracket_id, rating, maxRatingDifference, discardTime, discardOpponentsTime, aTeam, hTeam))
+            return true;
+
+        return startArena(aTeam, hTeam);
+    };
+
+    // arenaRating is the rating of the latest joined team, or 0 on automatic update calls
+    if (arenaRating && !tryRating(arenaRating))
+        return;
+
+    // then every waiting team gets its own rating window tried, longest waiting first
+    std::vector<GroupQueueInfo*> waitingTeams;
+    for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; i++)
+        for (GroupQueueInfo* ginfo : m_QueuedGroups[bracket_id][i])
+            if (!ginfo->IsInvitedToBGInstanceGUID)
+                waitingTeams.push_back(ginfo);
+
+    std::stable_sort(waitingTeams.begin(), waitingTeams.end(), [](GroupQueueInfo const* left, GroupQueueInfo const* right) { return left->JoinTime < right->JoinTime; });
+
+    for (GroupQueueInfo* ginfo : waitingTeams)
+    {
+        // invited by a previous match of this update
+        if (ginfo->IsInvitedToBGInstanceGUID)
+            continue;
+
+        if (!tryRating(ginfo->ArenaMatchmakerRating))
+            return;
+    }
+}
+
+bool BattlegroundQueue::FindRatedArenaMatch(BattlegroundBracketId bracket_id, uint32 rating, uint32 maxRatingDifference, int32 discardTime, int32 discardOpponentsTime,
+    GroupQueueInfo*& aTeam, GroupQueueInfo*& hTeam)
+{
+    // found out the minimum and maximum ratings the teams should battle against
+    uint32 arenaMinRating = (rating <= maxRatingDifference) ? 0 : rating - maxRatingDifference;
+    uint32 arenaMaxRating = rating + maxRatingDifference;
+
+    // we need to find 2 teams which will play next game, the ones that joined first
+    aTeam = FindRatedArenaTeam(bracket_id, BG_QUEUE_PREMADE_ALLIANCE, arenaMinRating, arenaMaxRating, discardTime);
+    hTeam = FindRatedArenaTeam(bracket_id, BG_QUEUE_PREMADE_HORDE, arenaMinRating, arenaMaxRating, discardTime);
+
+    // only one side has teams in range, look for an opponent in the same queue
+    if (!hTeam && aTeam)
+        hTeam = FindRatedArenaTeam(bracket_id, BG_QUEUE_PREMADE_ALLIANCE, arenaMinRating, arenaMaxRating, discardTime, aTeam, discardOpponentsTime);
+    else if (!aTeam && hTeam)
+    {
+        aTeam = hTeam;
+        hTeam = FindRatedArenaTeam(bracket_id, BG_QUEUE_PREMADE_HORDE, arenaMinRating, arenaMaxRating, discardTime, aTeam, discardOpponentsTime);
+    }
+
+    return aTeam && hTeam;
+}
+
+GroupQueueInfo* BattlegroundQueue::FindRatedArenaTeam(BattlegroundBracketId bracket_id, uint8 groupType, uint32 minRating, uint32 maxRating, int32 discardTime,
+    GroupQueueInfo const* opponent /*= nullptr*/, int32 discardOpponentsTime /*= 0*/)
+{
+    auto canPlay = [&](GroupQueueInfo const* ginfo)
+    {
+        if (ginfo->IsInvitedToBGInstanceGUID)
+            return false;
+
+        if (!opponent)
+            return true;
+
+        return ginfo != opponent && ginfo->ArenaTeamId != opponent->ArenaTeamId
+            && (opponent->ArenaTeamId != ginfo->PreviousOpponentsTeamId || (int32)ginfo->JoinTime < discardOpponentsTime);
+    };
+
+    // teams waiting longer than the rating discard timer play against any rating, they are at the front of the queue
+    bool passedOpponent = !opponent;
+    for (GroupQueueInfo* ginfo : m_QueuedGroups[bracket_id][groupType])
+    {
+        if (ginfo == opponent)
+        {
+            passedOpponent = true;
+            continue;
         }
+
+        // invited teams may have been moved to the front
+        if (ginfo->IsInvitedToBGInstanceGUID)
+            continue;
+
+        if ((int32)ginfo->JoinTime >= discardTime)
+            break;
+
+        if (passedOpponent && canPlay(ginfo))
+            return ginfo;
+    }
+
+    // otherwise the longest waiting team in the rating window
+    GroupQueueInfo* found = nullptr;
+    auto end = m_RatedTeamsByRating[bracket_id].upper_bound(maxRating);
+    for (auto itr = m_RatedTeamsByRating[bracket_id].lower_bound(minRating); itr != end; ++itr)
+    {
+        GroupQueueInfo* ginfo = itr->second;
+        if (ginfo->GroupType != groupType || !canPlay(ginfo))
+            continue;
+
+        if (opponent && ginfo->JoinTime < opponent->JoinTime)
+            continue;
+
+        if (!found || ginfo->JoinTime < found->JoinTime)
+            found = ginfo;
     }
+
+    return found;
 }
 
 void BattlegroundQueue::BattlegroundQueueAnnouncerUpdate(uint32 diff, BattlegroundQueueTypeId bgQueueTypeId, BattlegroundBracketId bracket_id)
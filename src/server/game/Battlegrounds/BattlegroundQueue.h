@@ -24,6 +24,8 @@
 #include "EventProcessor.h"
 #include <array>
 #include <deque>
+#include <functional>
+#include <map>
 
 constexpr auto COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME = 10;
 
@@ -90,6 +92,17 @@ public:
 
     void AddEvent(BasicEvent* Event, uint64 e_time);
 
+    // queues a group filled by AddGroup, rated teams are also indexed by matchmaker rating
+    void AddGroupToQueue(GroupQueueInfo* ginfo);
+
+    // pairs the waiting rated arena teams, startArena is called for every match and returns false if the arena could not be created
+    void StartRatedArenas(BattlegroundBracketId bracket_id, uint32 arenaRating, uint32 maxRatingDifference, int32 discardTime, int32 discardOpponentsTime,
+        std::function<bool(GroupQueueInfo*, GroupQueueInfo*)> const& startArena);
+
+    // the next two teams to play in the rating window around rating, aTeam and hTeam may come from the same faction queue
+    bool FindRatedArenaMatch(BattlegroundBracketId bracket_id, uint32 rating, uint32 maxRatingDifference, int32 discardTime, int32 discardOpponentsTime,
+        GroupQueueInfo*& aTeam, GroupQueueInfo*& hTeam);
+
     typedef std::map<ObjectGuid, GroupQueueInfo*> QueuedPlayersMap;
     QueuedPlayersMap m_QueuedPlayers;
 
@@ -129,6 +142,13 @@ public:
     [[nodiscard]] int32 GetQueueAnnouncementTimer(uint32 bracketId) const;
 
 private:
+    // longest waiting team of a rated arena queue that can play in the rating range, or against opponent when set
+    GroupQueueInfo* FindRatedArenaTeam(BattlegroundBracketId bracket_id, uint8 groupType, uint32 minRating, uint32 maxRating, int32 discardTime,
+        GroupQueueInfo const* opponent = nullptr, int32 discardOpponentsTime = 0);
+
+    // rated teams of m_QueuedGroups by matchmaker rating, so finding opponents is a range query
+    std::multimap<uint32, GroupQueueInfo*> m_RatedTeamsByRating[MAX_BATTLEGROUND_BRACKETS];
+
     uint32 m_WaitTimes[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS][COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME];
     uint32 m_WaitTimeLastIndex[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
 
@@ -16,6 +16,7 @@
  */
 
 #include "WhoListCacheMgr.h"
+#include "Guild.h"
 #include "GuildMgr.h"
 #include "ObjectAccessor.h"
 #include "World.h"
@@ -28,34 +29,90 @@ WhoListCacheMgr* WhoListCacheMgr::instance()
 
 void WhoListCacheMgr::Update()
 {
-    // clear current list
-    _whoListStorage.clear();
+    // the previous list is consumed while building the new one, names of players already listed are
+    // only converted again when they changed, which is the bulk of the work with many players online
+    WhoListInfoVector previous;
+    previous.swap(_whoListStorage);
     _whoListStorage.reserve(sWorld->GetPlayerCount() + 1);
 
+    std::unordered_map<ObjectGuid, uint32> previousIndex;
+    previousIndex.swap(_guidIndex);
+
     for (auto const& [guid, player] : ObjectAccessor::GetPlayers())
     {
         if (!player->FindMap() || player->GetSession()->PlayerLoading())
             continue;
 
-        std::string playerName = player->GetName();
+        WhoListPlayerInfo* cached = nullptr;
+        auto itr = previousIndex.find(guid);
+        if (itr != previousIndex.end())
+            cached = &previous[itr->second];
+
+        std::string playerName;
         std::wstring widePlayerName;
 
-        if (!Utf8toWStr(playerName, widePlayerName))
-            continue;
+        if (cached && cached->_playerName == player->GetName())
+        {
+            playerName = std::move(cached->_playerName);
+            widePlayerName = std::move(cached->_widePlayerName);
+        }
+        else
+        {
+            playerName = player->GetName();
+
+            if (!Utf8toWStr(playerName, widePlayerName))
+                continue;
 
-        wstrToLower(widePlayerName);
+            wstrToLower(widePlayerName);
+        }
 
-        std::string guildName = sGuildMgr->GetGuildNameById(player->GetGuildId());
+        Guild* guild = player->GetGuildId() ? sGuildMgr->GetGuildById(player->GetGuildId()) : nullptr;
+
+        std::string guildName;
         std::wstring wideGuildName;
 
-        if (!Utf8toWStr(guildName, wideGuildName))
-            continue;
+        if (cached && (guild ? cached->_guildName == guild->GetName() : cached->_guildName.empty()))
+        {
+            guildName = std::move(cached->_guildName);
+            wideGuildName = std::move(cached->_wideGuildName);
+        }
+        else
+        {
+            if (guild)
+                guildName = guild->GetName();
+
+            if (!Utf8toWStr(guildName, wideGuildName))
+                continue;
 
-        wstrToLower(wideGuildName);
+            wstrToLower(wideGuildName);
+        }
 
+        _guidIndex[guid] = _whoListStorage.size();
         _whoListStorage.emplace_back(player->GetGUID(), player->GetTeamId(), player->GetSession()->GetSecurity(), player->GetLevel(),
             player->getClass(), player->getRace(),
             (player->IsSpectator() ? 4395 /*Dalaran*/ : player->GetZoneId()), player->getGender(), player->IsVisible(),
-            widePlayerName, wideGuildName, playerName, guildName);
+            std::move(widePlayerName), std::move(wideGuildName), std::move(playerName), std::move(guildName));
     }
+
+    // zone buckets keep their vectors between updates to avoid reallocating them
+    for (auto& [zoneId, indexes] : _zoneIndex)
+        indexes.clear();
+
+    _levelOffsets.fill(0);
+    for (uint32 i = 0; i < _whoListStorage.size(); ++i)
+    {
+        _zoneIndex[_whoListStorage[i].GetZoneId()].push_back(i);
+        ++_levelOffsets[_whoListStorage[i].GetLevel() + 1];
+    }
+
+    std::erase_if(_zoneIndex, [](auto const& bucket) { return bucket.second.empty(); });
+
+    // counting sort by level
+    for (uint32 level = 1; level < _levelOffsets.size(); ++level)
+        _levelOffsets[level] += _levelOffsets[level - 1];
+
+    std::array<uint32, STRONG_MAX_LEVEL + 2> positions = _levelOffsets;
+    _levelIndex.resize(_whoListStorage.size());
+    for (uint32 i = 0; i < _whoListStorage.size(); ++i)
+        _levelIndex[positions[_whoListStorage[i].GetLevel()]++] = i;
 }
@@ -19,14 +19,18 @@
 #define _WHO_LISTCACHE_H_
 
 #include "Common.h"
+#include "DBCEnums.h"
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
+#include <algorithm>
+#include <array>
+#include <unordered_map>
 
 class WhoListPlayerInfo
 {
 public:
-    WhoListPlayerInfo(ObjectGuid guid, TeamId team, AccountTypes security, uint8 level, uint8 clss, uint8 race, uint32 zoneid, uint8 gender, bool visible, std::wstring const& widePlayerName,
-        std::wstring const& wideGuildName, std::string const& playerName, std::string const& guildName) :
+    WhoListPlayerInfo(ObjectGuid guid, TeamId team, AccountTypes security, uint8 level, uint8 clss, uint8 race, uint32 zoneid, uint8 gender, bool visible, std::wstring widePlayerName,
+        std::wstring wideGuildName, std::string playerName, std::string guildName) :
         _guid(guid),
         _team(team),
         _security(security),
@@ -36,10 +40,10 @@ public:
         _zoneid(zoneid),
         _gender(gender),
         _visible(visible),
-        _widePlayerName(widePlayerName),
-        _wideGuildName(wideGuildName),
-        _playerName(playerName),
-        _guildName(guildName) { }
+        _widePlayerName(std::move(widePlayerName)),
+        _wideGuildName(std::move(wideGuildName)),
+        _playerName(std::move(playerName)),
+        _guildName(std::move(guildName)) { }
 
     ObjectGuid GetGuid() const { return _guid; }
     TeamId GetTeamId() const { return _team; }
@@ -56,6 +60,8 @@ public:
     std::string const& GetGuildName() const { return _guildName; }
 
 private:
+    friend class WhoListCacheMgr;
+
     ObjectGuid _guid;
     TeamId _team;
     AccountTypes _security;
@@ -89,8 +95,46 @@ public:
     void Update();
     WhoListInfoVector const& GetWhoList() const { return _whoListStorage; }
 
+    /// Calls worker for every entry in one of the zones, or when no zone is given in the level range.
+    /// Any other filter, including the level range for zone searches, is up to the caller.
+    template<typename Worker>
+    void DoForCandidates(uint32 levelMin, uint32 levelMax, uint32 const* zoneIds, uint32 zonesCount, Worker&& worker) const
+    {
+        if (zonesCount)
+        {
+            for (uint32 i = 0; i < zonesCount; ++i)
+            {
+                // the client may send the same zone twice
+                if (std::find(zoneIds, zoneIds + i, zoneIds[i]) != zoneIds + i)
+                    continue;
+
+                auto itr = _zoneIndex.find(zoneIds[i]);
+                if (itr == _zoneIndex.end())
+                    continue;
+
+                for (uint32 index : itr->second)
+                    worker(_whoListStorage[index]);
+            }
+
+            return;
+        }
+
+        if (levelMin > levelMax || levelMin > STRONG_MAX_LEVEL)
+            return;
+
+        levelMax = std::min<uint32>(levelMax, STRONG_MAX_LEVEL);
+        for (uint32 i = _levelOffsets[levelMin]; i < _levelOffsets[levelMax + 1]; ++i)
+            worker(_whoListStorage[_levelIndex[i]]);
+    }
+
 protected:
     WhoListInfoVector _whoListStorage;
+
+    // positions in _whoListStorage, rebuilt with it
+    std::unordered_map<ObjectGuid, uint32> _guidIndex;
+    std::unordered_map<uint32, std::vector<uint32>> _zoneIndex;
+    std::vector<uint32> _levelIndex;                                   // ordered by level
+    std::array<uint32, STRONG_MAX_LEVEL + 2> _levelOffsets = {};       // first _levelIndex position of each level
 };
 
 #define sWhoListCacheMgr WhoListCacheMgr::instance()
@@ -0,0 +1,153 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldDataCache.h"
+#include "ByteBuffer.h"
+#include "Config.h"
+#include "DatabaseEnv.h"
+#include "Log.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    constexpr uint32 WORLD_DATA_CACHE_MAGIC = 0x44574341; // "ACWD"
+    constexpr uint32 WORLD_DATA_CACHE_VERSION = 1;
+
+    std::string GetCacheDirectory()
+    {
+        std::string directory = sConfigMgr->GetOption<std::string>("WorldDataCache.Directory", "");
+        if (!directory.empty() && directory.back() != '/' && directory.back() != '\\')
+            directory.push_back('/');
+
+        return directory;
+    }
+}
+
+std::string WorldDataCache::GetTablesKey(std::string const& tables)
+{
+    if (GetCacheDirectory().empty())
+        return "";
+
+    // CHECKSUM TABLE hashes the table contents, reading a live checksum (CHECKSUM=1 table option) when there is one
+    // and scanning the rows on the MySQL server otherwise. Table metadata like UPDATE_TIME is not used, InnoDB
+    // does not persist it, so a change could go unnoticed and an outdated snapshot would be loaded.
+    QueryResult result = WorldDatabase.Query("CHECKSUM TABLE {}", tables);
+    if (!result || result->GetRowCount() != uint64(std::count(tables.begin(), tables.end(), ',') + 1))
+        return "";
+
+    std::string key;
+    do
+    {
+        Field* fields = result->Fetch();
+
+        // a missing table has no checksum
+        if (fields[1].IsNull())
+            return "";
+
+        key += fields[0].Get<std::string>();
+        key += ":checksum=";
+        key += fields[1].Get<std::string>();
+        key += ';';
+    } while (result->NextRow());
+
+    return key;
+}
+
+bool WorldDataCache::Load(std::string const& name, std::string const& key, ByteBuffer& data)
+{
+    if (key.empty())
+        return false;
+
+    std::ifstream file(GetCacheDirectory() + name + ".cache", std::ios::binary | std::ios::ate);
+    if (!file)
+        return false;
+
+    std::streamsize const size = file.tellg();
+    if (size <= 0)
+        return false;
+
+    ByteBuffer buffer;
+    buffer.resize(size);
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(buffer.contents()), size))
+        return false;
+
+    try
+    {
+        uint32 magic = buffer.read<uint32>();
+        uint32 version = buffer.read<uint32>();
+        std::string storedKey = buffer.ReadCString();
+        if (magic != WORLD_DATA_CACHE_MAGIC || version != WORLD_DATA_CACHE_VERSION || storedKey != key)
+        {
+            LOG_INFO("server.loading", "World data cache {} is outdated, loading from database.", name);
+            return false;
+        }
+    }
+    catch (ByteBufferException const&)
+    {
+        LOG_ERROR("server.loading", "World data cache {} is corrupted, loading from database.", name);
+        return false;
+    }
+
+    data.append(buffer.contents() + buffer.rpos(), buffer.size() - buffer.rpos());
+    return true;
+}
+
+void WorldDataCache::Save(std::string const& name, std::string const& key, ByteBuffer const& data)
+{
+    if (key.empty())
+        return;
+
+    // written next to the snapshot and renamed over it, a crash mid write never leaves a truncated snapshot behind
+    std::string const fileName = GetCacheDirectory() + name + ".cache";
+    std::string const tempFileName = fileName + ".tmp";
+    {
+        std::ofstream file(tempFileName, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            LOG_ERROR("server.loading", "Unable to write world data cache {}.", tempFileName);
+            return;
+        }
+
+        ByteBuffer header;
+        header << uint32(WORLD_DATA_CACHE_MAGIC);
+        header << uint32(WORLD_DATA_CACHE_VERSION);
+        header << key;
+
+        file.write(reinterpret_cast<char const*>(header.contents()), header.wpos());
+        file.write(reinterpret_cast<char const*>(data.contents()), data.wpos());
+        file.flush();
+        if (!file)
+        {
+            LOG_ERROR("server.loading", "Unable to write world data cache {}.", tempFileName);
+            file.close();
+            std::error_code error;
+            std::filesystem::remove(tempFileName, error);
+            return;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempFileName, fileName, error);
+    if (error)
+    {
+        LOG_ERROR("server.loading", "Unable to replace world data cache {}: {}", fileName, error.message());
+        std::filesystem::remove(tempFileName, error);
+    }
+}
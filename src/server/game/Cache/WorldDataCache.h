@@ -0,0 +1,43 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _WORLD_DATA_CACHE_H_
+#define _WORLD_DATA_CACHE_H_
+
+#include "Define.h"
+#include <string>
+
+class ByteBuffer;
+
+/// Binary snapshots of world database rows, stored in WorldDataCache.Directory.
+/// A snapshot is keyed by the CHECKSUM TABLE of its source tables, so any change to their
+/// contents (DB updates, in game edits, manual queries) invalidates it. Computing the key
+/// scans those tables on the MySQL server, which is still far cheaper than sending and
+/// parsing their rows.
+namespace WorldDataCache
+{
+    /// Returns the content key for a comma separated list (no spaces) of world tables,
+    /// or an empty string when the cache is disabled or a table can't be checksummed.
+    AC_GAME_API std::string GetTablesKey(std::string const& tables);
+
+    /// Fills data with the snapshot payload if one exists for name and matches key
+    AC_GAME_API bool Load(std::string const& name, std::string const& key, ByteBuffer& data);
+
+    AC_GAME_API void Save(std::string const& name, std::string const& key, ByteBuffer const& data);
+}
+
+#endif
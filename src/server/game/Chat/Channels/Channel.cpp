@@ -22,6 +22,7 @@
 #include "DatabaseEnv.h"
 #include "GameTime.h"
 #include "ObjectMgr.h"
+#include "PacketBroadcast.h"
 #include "Player.h"
 #include "SocialMgr.h"
 #include "World.h"
@@ -813,7 +814,56 @@ void Channel::Say(ObjectGuid guid, std::string const& what, uint32 lang)
         ChatHandler::BuildChatPacket(data, CHAT_MSG_CHANNEL, Language(lang), guid, guid, what, 0, "", "", 0, false, _name);
     }
 
-    SendToAll(&data, pinfo.IsModerator() ? ObjectGuid::Empty : guid);
+    ObjectGuid ignoredBy = pinfo.IsModerator() ? ObjectGuid::Empty : guid;
+    if (sWorld->getBoolConfig(CONFIG_CHAT_CHANNEL_BATCHING) && playersStore.size() >= sWorld->getIntConfig(CONFIG_CHAT_CHANNEL_BATCHING_MIN_MEMBERS))
+    {
+        QueueMessage(std::move(data), guid, ignoredBy);
+        return;
+    }
+
+    SendToAll(&data, ignoredBy);
+}
+
+void Channel::QueueMessage(WorldPacket&& data, ObjectGuid sender, ObjectGuid ignoredBy)
+{
+    uint32 pendingFromSender = std::count_if(_outboundQueue.begin(), _outboundQueue.end(), [sender](QueuedMessage const& message) { return message.Sender == sender; });
+
+    // flood control, a full queue or a sender with too many undelivered messages gets throttled
+    if (_outboundQueue.size() >= sWorld->getIntConfig(CONFIG_CHAT_CHANNEL_BATCHING_QUEUE_SIZE) ||
+        pendingFromSender >= sWorld->getIntConfig(CONFIG_CHAT_CHANNEL_BATCHING_MAX_PENDING_PER_PLAYER))
+    {
+        ++_outboundStatistics.Dropped;
+
+        WorldPacket throttled;
+        MakeThrottled(&throttled);
+        SendToOne(&throttled, sender);
+        return;
+    }
+
+    if (_outboundQueue.empty())
+        ChannelMgr::ScheduleDelivery(this);
+
+    _outboundQueue.push_back({ std::move(data), sender, ignoredBy });
+    ++_outboundStatistics.Queued;
+    _outboundStatistics.MaxQueueSize = std::max<uint32>(_outboundStatistics.MaxQueueSize, _outboundQueue.size());
+}
+
+void Channel::DeliverQueuedMessages(uint32 maxMessages)
+{
+    for (uint32 i = 0; i < maxMessages && !_outboundQueue.empty(); ++i)
+    {
+        QueuedMessage& message = _outboundQueue.front();
+        SendToAll(&message.Packet, message.IgnoredBy);
+        _outboundQueue.pop_front();
+        ++_outboundStatistics.Delivered;
+    }
+}
+
+Channel::OutboundStatistics Channel::CollectOutboundStatistics()
+{
+    OutboundStatistics statistics = _outboundStatistics;
+    _outboundStatistics = OutboundStatistics();
+    return statistics;
 }
 
 void Channel::Invite(Player const* player, std::string const& newname)
@@ -925,16 +975,18 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
 
 void Channel::SendToAll(WorldPacket* data, ObjectGuid guid)
 {
+    PacketBroadcast broadcast(data, BROADCAST_SOURCE_CHANNEL);
     for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
         if (!guid || !i->second.plrPtr->GetSocial()->HasIgnore(guid))
-            i->second.plrPtr->GetSession()->SendPacket(data);
+            broadcast.SendTo(i->second.plrPtr->GetSession());
 }
 
 void Channel::SendToAllButOne(WorldPacket* data, ObjectGuid who)
 {
+    PacketBroadcast broadcast(data, BROADCAST_SOURCE_CHANNEL);
     for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
         if (i->first != who)
-            i->second.plrPtr->GetSession()->SendPacket(data);
+            broadcast.SendTo(i->second.plrPtr->GetSession());
 }
 
 void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
@@ -945,8 +997,9 @@ void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
 
 void Channel::SendToAllWatching(WorldPacket* data)
 {
+    PacketBroadcast broadcast(data, BROADCAST_SOURCE_CHANNEL);
     for (PlayersWatchingContainer::const_iterator i = playersWatchingStore.begin(); i != playersWatchingStore.end(); ++i)
-        (*i)->GetSession()->SendPacket(data);
+        broadcast.SendTo((*i)->GetSession());
 }
 
 void Channel::Voice(ObjectGuid /*guid1*/, ObjectGuid /*guid2*/)
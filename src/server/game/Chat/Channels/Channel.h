@@ -21,6 +21,7 @@
 #include "Common.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
+#include <deque>
 #include <list>
 #include <map>
 #include <string>
@@ -179,10 +180,19 @@ class Channel
     };
 
 public:
+    struct OutboundStatistics
+    {
+        uint32 Queued = 0;
+        uint32 Delivered = 0;
+        uint32 Dropped = 0;
+        uint32 MaxQueueSize = 0;
+    };
+
     Channel(std::string const& name, uint32 channel_id, uint32 channelDBId, TeamId teamId = TEAM_NEUTRAL, bool announce = true, bool ownership = true);
     [[nodiscard]] std::string const& GetName() const { return _name; }
     [[nodiscard]] uint32 GetChannelId() const { return _channelId; }
     [[nodiscard]] uint32 GetChannelDBId() const { return _channelDBId; }
+    [[nodiscard]] TeamId GetTeamId() const { return _teamId; }
     [[nodiscard]] bool IsConstant() const { return _channelId != 0; }
     [[nodiscard]] bool IsAnnounce() const { return _announce; }
     [[nodiscard]] bool IsLFG() const { return GetFlags() & CHANNEL_FLAG_LFG; }
@@ -225,6 +235,12 @@ public:
     void AddWatching(Player* p);
     void RemoveWatching(Player* p);
 
+    // Outbound queue, only used by Say for channels at or above ChatChannel.Batching.MinMembers
+    void DeliverQueuedMessages(uint32 maxMessages);
+    [[nodiscard]] bool HasQueuedMessages() const { return !_outboundQueue.empty(); }
+    // Returns the queue counters since the previous call and resets them
+    OutboundStatistics CollectOutboundStatistics();
+
 private:
     // initial packet data (notify type and channel name)
     void MakeNotifyPacket(WorldPacket* data, uint8 notify_type);
@@ -271,6 +287,8 @@ private:
     void SendToOne(WorldPacket* data, ObjectGuid who);
     void SendToAllWatching(WorldPacket* data);
 
+    void QueueMessage(WorldPacket&& data, ObjectGuid sender, ObjectGuid ignoredBy);
+
     [[nodiscard]] bool IsOn(ObjectGuid who) const { return playersStore.find(who) != playersStore.end(); }
     [[nodiscard]] bool IsBanned(ObjectGuid guid) const;
 
@@ -319,6 +337,13 @@ private:
     typedef std::unordered_map<ObjectGuid, uint32> BannedContainer;
     typedef std::unordered_set<Player*> PlayersWatchingContainer;
 
+    struct QueuedMessage
+    {
+        WorldPacket Packet;
+        ObjectGuid Sender;
+        ObjectGuid IgnoredBy;
+    };
+
     bool _announce;
     bool _moderation;
     bool _ownership;
@@ -335,5 +360,7 @@ private:
     PlayerContainer playersStore;
     BannedContainer bannedStore;
     PlayersWatchingContainer playersWatchingStore;
+    std::deque<QueuedMessage> _outboundQueue;
+    OutboundStatistics _outboundStatistics;
 };
 #endif
@@ -162,6 +162,8 @@ Channel* ChannelMgr::GetChannel(std::string const& name, Player* player, bool pk
 uint32 ChannelMgr::_channelIdMax = 0;
 ChannelMgr::ChannelRightsMap ChannelMgr::channels_rights;
 ChannelRights ChannelMgr::channelRightsEmpty;
+std::vector<Channel*> ChannelMgr::_deliveryQueue;
+std::unordered_set<Channel*> ChannelMgr::_batchedChannels;
 
 void ChannelMgr::LoadChannelRights()
 {
@@ -227,3 +229,35 @@ void ChannelMgr::MakeNotOnPacket(WorldPacket* data, std::string const& name)
     data->Initialize(SMSG_CHANNEL_NOTIFY, 1 + name.size());
     (*data) << uint8(5) << name;
 }
+
+void ChannelMgr::ScheduleDelivery(Channel* channel)
+{
+    _deliveryQueue.push_back(channel);
+    _batchedChannels.insert(channel);
+}
+
+void ChannelMgr::Update()
+{
+    if (_deliveryQueue.empty())
+        return;
+
+    uint32 maxMessages = sWorld->getIntConfig(CONFIG_CHAT_CHANNEL_BATCHING_MESSAGES_PER_UPDATE);
+
+    // channels are never deleted while the world is running, so the pointers stay valid
+    _deliveryQueue.erase(std::remove_if(_deliveryQueue.begin(), _deliveryQueue.end(), [maxMessages](Channel* channel)
+    {
+        channel->DeliverQueuedMessages(maxMessages);
+        return !channel->HasQueuedMessages();
+    }), _deliveryQueue.end());
+}
+
+std::vector<ChannelMgr::ChannelStatistics> ChannelMgr::CollectStatistics()
+{
+    std::vector<ChannelStatistics> statistics;
+    statistics.reserve(_batchedChannels.size());
+
+    for (Channel* channel : _batchedChannels)
+        statistics.push_back({ channel->GetName(), channel->GetTeamId(), channel->CollectOutboundStatistics() });
+
+    return statistics;
+}
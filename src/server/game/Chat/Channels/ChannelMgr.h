@@ -48,11 +48,25 @@ public:
     static void SetChannelRightsFor(const std::string& name, const uint32& flags, const uint32& speakDelay, const std::string& joinmessage, const std::string& speakmessage, const std::set<uint32>& moderators);
     static uint32 _channelIdMax;
 
+    struct ChannelStatistics
+    {
+        std::string Name;
+        TeamId Team;
+        Channel::OutboundStatistics Outbound;
+    };
+
+    // Queued channel chat, see Channel::QueueMessage
+    static void ScheduleDelivery(Channel* channel);
+    static void Update();
+    static std::vector<ChannelStatistics> CollectStatistics();
+
 private:
     ChannelMap channels;
     TeamId _teamId;
     static ChannelRightsMap channels_rights;
     static ChannelRights channelRightsEmpty; // when not found in the map, reference to this is returned
+    static std::vector<Channel*> _deliveryQueue;
+    static std::unordered_set<Channel*> _batchedChannels; // every channel that ever queued, for metrics
 
     void MakeNotOnPacket(WorldPacket* data, std::string const& name);
 };
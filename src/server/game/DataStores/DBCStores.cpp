@@ -24,9 +24,11 @@
 #include "Log.h"
 #include "SharedDefines.h"
 #include "SpellMgr.h"
+#include "StartupLoader.h"
 #include "TransportMgr.h"
 #include "World.h"
 #include <map>
+#include <mutex>
 
 typedef std::map<uint16, uint32> AreaFlagByAreaID;
 typedef std::map<uint32, uint32> AreaFlagByMapID;
@@ -200,6 +202,9 @@ typedef std::list<std::string> StoreProblemList;
 
 uint32 DBCFileCount = 0;
 
+// guards DBCFileCount, the available locales mask and the problem list while stores load in parallel
+static std::mutex DBCLoadLock;
+
 static bool LoadDBC_assert_print(uint32 fsize, uint32 rsize, const std::string& filename)
 {
     LOG_ERROR("dbc", "Size of '{}' set by format string ({}) not equal size of C++ structure ({}).", filename, fsize, rsize);
@@ -214,7 +219,13 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
     // compatibility format and C++ structure sizes
     ASSERT(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDBC_assert_print(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
 
-    ++DBCFileCount;
+    uint32 locales;
+    {
+        std::lock_guard<std::mutex> guard(DBCLoadLock);
+        ++DBCFileCount;
+        locales = availableDbcLocales;
+    }
+
     std::string dbcFilename = dbcPath + filename;
     bool existDBData = false;
 
@@ -222,7 +233,7 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
     {
         for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
         {
-            if (!(availableDbcLocales & (1 << i)))
+            if (!(locales & (1 << i)))
                 continue;
 
             std::string localizedName(dbcPath);
@@ -231,8 +242,11 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
             localizedName.append(filename);
 
             if (!storage.LoadStringsFrom(localizedName.c_str()))
-                availableDbcLocales &= ~(1 << i);             // mark as not available for speedup next checks
+                locales &= ~(1 << i);                         // mark as not available for speedup next checks
         }
+
+        std::lock_guard<std::mutex> guard(DBCLoadLock);
+        availableDbcLocales &= locales;
     }
 
     if (dbTable)
@@ -249,15 +263,20 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
             std::ostringstream stream;
             stream << dbcFilename << " exists, and has " << storage.GetFieldCount() << " field(s) (expected " << strlen(storage.GetFormat()) << "). Extracted file might be from wrong client version or a database-update has been forgotten.";
             std::string buf = stream.str();
-            errors.push_back(buf);
             fclose(f);
+
+            std::lock_guard<std::mutex> guard(DBCLoadLock);
+            errors.push_back(buf);
         }
         else
+        {
+            std::lock_guard<std::mutex> guard(DBCLoadLock);
             errors.push_back(dbcFilename);
+        }
     }
 }
 
-void LoadDBCStores(const std::string& dataPath)
+void LoadDBCStores(const std::string& dataPath, uint32 threads)
 {
     uint32 oldMSTime = getMSTime();
 
@@ -266,7 +285,10 @@ void LoadDBCStores(const std::string& dataPath)
     StoreProblemList bad_dbc_files;
     uint32 availableDbcLocales = 0xFFFFFFFF;
 
-#define LOAD_DBC(store, file, dbtable) LoadDBC(availableDbcLocales, bad_dbc_files, store, dbcPath, file, dbtable)
+    // every store is independent from the others, so they all go to the same graph level
+    StartupLoaderGraph dbcLoaders;
+
+#define LOAD_DBC(store, file, dbtable) dbcLoaders.Add(file, [&] { LoadDBC(availableDbcLocales, bad_dbc_files, store, dbcPath, file, dbtable); })
 
     LOAD_DBC(sAreaTableStore,                       "AreaTable.dbc",                        "areatable_dbc");
     LOAD_DBC(sAchievementStore,                     "Achievement.dbc",                      "achievement_dbc");
@@ -383,6 +405,8 @@ void LoadDBCStores(const std::string& dataPath)
 
 #undef LOAD_DBC
 
+    dbcLoaders.Run(threads);
+
     for (CharStartOutfitEntry const* outfit : sCharStartOutfitStore)
         sCharStartOutfitMap[outfit->Race | (outfit->Class << 8) | (outfit->Gender << 16)] = outfit;
 
@@ -624,6 +648,8 @@ void LoadDBCStores(const std::string& dataPath)
     }
     else if (!bad_dbc_files.empty())
     {
+        bad_dbc_files.sort();
+
         std::string str;
         for (StoreProblemList::iterator i = bad_dbc_files.begin(); i != bad_dbc_files.end(); ++i)
             str += *i + "\n";
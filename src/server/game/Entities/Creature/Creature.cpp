@@ -598,8 +598,38 @@ bool Creature::UpdateEntry(uint32 Entry, const CreatureData* data, bool changele
     return true;
 }
 
+bool Creature::IsIdleForUpdate(uint32 pendingDiff) const
+{
+    if (!IsAlive() || TriggerJustRespawned || IsInCombat() || IsInEvadeMode() || isActiveObject())
+        return false;
+
+    // controlled, summoned and vehicle creatures follow someone else's state
+    if (IsSummon() || GetCharmerOrOwnerGUID() || GetVehicleKit() || GetVehicle())
+        return false;
+
+    if (GetHealth() != GetMaxHealth() || HasUnitState(UNIT_STATE_CASTING))
+        return false;
+
+    if (!movespline->Finalized() || GetMotionMaster()->GetCurrentMovementGeneratorType() != IDLE_MOTION_TYPE)
+        return false;
+
+    uint64 nextEventTime = m_Events.GetNextEventTime();
+    return !nextEventTime || nextEventTime > m_Events.CalculateTime(pendingDiff);
+}
+
 void Creature::Update(uint32 diff)
 {
+    // idle creatures only get a full update every CONFIG_CREATURE_IDLE_UPDATE_INTERVAL, including the time they skipped
+    if (uint32 idleUpdateInterval = sWorld->getIntConfig(CONFIG_CREATURE_IDLE_UPDATE_INTERVAL))
+    {
+        _idleUpdateDiff += diff;
+        if (_idleUpdateDiff < idleUpdateInterval && IsIdleForUpdate(_idleUpdateDiff))
+            return;
+
+        diff = _idleUpdateDiff;
+        _idleUpdateDiff = 0;
+    }
+
     if (IsAIEnabled && TriggerJustRespawned)
     {
         TriggerJustRespawned = false;
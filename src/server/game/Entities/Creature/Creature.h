@@ -24,6 +24,7 @@
 #include "DatabaseEnv.h"
 #include "ItemTemplate.h"
 #include "LootMgr.h"
+#include "ObjectPool.h"
 #include "Unit.h"
 #include "UpdateMask.h"
 #include "World.h"
@@ -48,6 +49,8 @@ public:
     explicit Creature(bool isWorldObject = false);
     ~Creature() override;
 
+    OBJECT_POOL_ALLOCATED("Creature")
+
     void AddToWorld() override;
     void RemoveFromWorld() override;
 
@@ -486,6 +489,9 @@ private:
 
     uint32 _playerDamageReq;
     bool _damagedByPlayer;
+
+    [[nodiscard]] bool IsIdleForUpdate(uint32 pendingDiff) const;
+    uint32 _idleUpdateDiff{0};                          // time skipped while idle, see Creature.IdleUpdateInterval
 };
 
 class AssistDelayEvent : public BasicEvent
@@ -2177,6 +2177,7 @@ void GameObject::SendMessageToSetInRange(WorldPacket const* data, float dist, bo
         dist += VISIBILITY_COMPENSATION * 2.0f; // pussywizard: to ensure everyone receives all important packets
     Acore::MessageDistDeliverer notifier(this, data, dist, false, skipped_rcvr);
     Cell::VisitWorldObjects(this, notifier, dist);
+    notifier.Deliver();
 }
 
 void GameObject::EventInform(uint32 eventId)
@@ -23,6 +23,7 @@
 #include "G3D/Quat.h"
 #include "LootMgr.h"
 #include "Object.h"
+#include "ObjectPool.h"
 #include "SharedDefines.h"
 #include "GameObjectData.h"
 #include "Unit.h"
@@ -124,6 +125,8 @@ public:
     explicit GameObject();
     ~GameObject() override;
 
+    OBJECT_POOL_ALLOCATED("GameObject")
+
     void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player* target) const override;
 
     void AddToWorld() override;
@@ -23,6 +23,7 @@
 #include "ItemTemplate.h"
 #include "LootMgr.h"
 #include "Object.h"
+#include "ObjectPool.h"
 
 class SpellInfo;
 class Bag;
@@ -218,6 +219,8 @@ public:
 
     Item();
 
+    OBJECT_POOL_ALLOCATED("Item")
+
     virtual bool Create(ObjectGuid::LowType guidlow, uint32 itemid, Player const* owner);
 
     [[nodiscard]] ItemTemplate const* GetTemplate() const;
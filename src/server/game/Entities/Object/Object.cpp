@@ -2084,6 +2084,7 @@ void WorldObject::SendMessageToSetInRange(WorldPacket const* data, float dist, b
         dist += VISIBILITY_COMPENSATION; // pussywizard: to ensure everyone receives all important packets
     Acore::MessageDistDeliverer notifier(this, data, dist, false, skipped_rcvr);
     Cell::VisitWorldObjects(this, notifier, dist);
+    notifier.Deliver();
 }
 
 void WorldObject::SendObjectDeSpawnAnim(ObjectGuid guid)
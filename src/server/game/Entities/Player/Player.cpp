@@ -5588,6 +5588,7 @@ void Player::SendMessageToSetInRange(WorldPacket const* data, float dist, bool s
         dist += VISIBILITY_COMPENSATION; // pussywizard: to ensure everyone receives all important packets
     Acore::MessageDistDeliverer notifier(this, data, dist, false, skipped_rcvr);
     Cell::VisitWorldObjects(this, notifier, dist);
+    notifier.Deliver();
 }
 
 void Player::SendMessageToSetInRange_OwnTeam(WorldPacket const* data, float dist, bool self) const
@@ -5597,6 +5598,7 @@ void Player::SendMessageToSetInRange_OwnTeam(WorldPacket const* data, float dist
 
     Acore::MessageDistDeliverer notifier(this, data, dist, true);
     Cell::VisitWorldObjects(this, notifier, dist);
+    notifier.Deliver();
 }
 
 void Player::SendDirectMessage(WorldPacket const* data) const
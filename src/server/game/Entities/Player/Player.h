@@ -2045,6 +2045,7 @@ public:
     [[nodiscard]] int16 GetSkillTempBonusValue(uint32 skill) const;
     [[nodiscard]] uint16 GetSkillStep(uint16 skill) const;            // 0...6
     [[nodiscard]] bool HasSkill(uint32 skill) const;
+    [[nodiscard]] bool IsHolidayActive(HolidayIds holiday) const;
     void learnSkillRewardedSpells(uint32 id, uint32 value);
 
     WorldLocation& GetTeleportDest() { return teleportStore_dest; }
@@ -0,0 +1,104 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PLAYER_ITEM_USABILITY_H
+#define _PLAYER_ITEM_USABILITY_H
+
+#include "ItemTemplate.h"
+#include "SharedDefines.h"
+
+/*
+    Item template checks of Player::CanUseItem, shared with code that has to decide on a copy of
+    the player's data instead of the live player (AuctionUsableFilter). PlayerState is Player or
+    such a copy and provides GetTeamId(bool), getClass(), getClassMask(), getRaceMask(), GetLevel(),
+    HasSkill(), GetSkillValue(), HasSpell(), IsHolidayActive() and GetReputationRank().
+*/
+namespace Acore
+{
+    // Faction, class, race, required skill, spell, level and holiday of an item template
+    template<class PlayerState>
+    InventoryResult CanUseItemTemplate(PlayerState const& player, ItemTemplate const* proto)
+    {
+        if ((proto->Flags2 & ITEM_FLAGS_EXTRA_HORDE_ONLY) && player.GetTeamId(true) != TEAM_HORDE)
+            return EQUIP_ERR_YOU_CAN_NEVER_USE_THAT_ITEM;
+
+        if ((proto->Flags2 & ITEM_FLAGS_EXTRA_ALLIANCE_ONLY) && player.GetTeamId(true) != TEAM_ALLIANCE)
+            return EQUIP_ERR_YOU_CAN_NEVER_USE_THAT_ITEM;
+
+        if ((proto->AllowableClass & player.getClassMask()) == 0 || (proto->AllowableRace & player.getRaceMask()) == 0)
+            return EQUIP_ERR_YOU_CAN_NEVER_USE_THAT_ITEM;
+
+        if (proto->RequiredSkill != 0)
+        {
+            if (player.GetSkillValue(proto->RequiredSkill) == 0)
+                return EQUIP_ERR_NO_REQUIRED_PROFICIENCY;
+            else if (player.GetSkillValue(proto->RequiredSkill) < proto->RequiredSkillRank)
+                return EQUIP_ERR_CANT_EQUIP_SKILL;
+        }
+
+        if (proto->RequiredSpell != 0 && !player.HasSpell(proto->RequiredSpell))
+            return EQUIP_ERR_NO_REQUIRED_PROFICIENCY;
+
+        if (player.GetLevel() < proto->RequiredLevel)
+            return EQUIP_ERR_CANT_EQUIP_LEVEL_I;
+
+        // If World Event is not active, prevent using event dependant items
+        if (proto->HolidayId && !player.IsHolidayActive(HolidayIds(proto->HolidayId)))
+            return EQUIP_ERR_CANT_DO_RIGHT_NOW;
+
+        return EQUIP_ERR_OK;
+    }
+
+    // Weapon and armor proficiency and the required reputation, checked for items the player has
+    template<class PlayerState>
+    InventoryResult CanUseItemProficiency(PlayerState const& player, ItemTemplate const* proto)
+    {
+        if (uint32 itemSkill = proto->GetSkill())
+        {
+            bool allowEquip = false;
+            // Armor that is binded to account can "morph" from plate to mail, etc. if skill is not learned yet.
+            if (proto->Quality == ITEM_QUALITY_HEIRLOOM && proto->Class == ITEM_CLASS_ARMOR && !player.HasSkill(itemSkill))
+            {
+                /// @todo: when you right-click already equipped item it throws EQUIP_ERR_NO_REQUIRED_PROFICIENCY.
+
+                // In fact it's a visual bug, everything works properly... I need sniffs of operations with
+                // binded to account items from off server.
+
+                switch (player.getClass())
+                {
+                    case CLASS_HUNTER:
+                    case CLASS_SHAMAN:
+                        allowEquip = (itemSkill == SKILL_MAIL);
+                        break;
+                    case CLASS_PALADIN:
+                    case CLASS_WARRIOR:
+                        allowEquip = (itemSkill == SKILL_PLATE_MAIL);
+                        break;
+                }
+            }
+            if (!allowEquip && player.GetSkillValue(itemSkill) == 0)
+                return EQUIP_ERR_NO_REQUIRED_PROFICIENCY;
+        }
+
+        if (proto->RequiredReputationFaction && uint32(player.GetReputationRank(proto->RequiredReputationFaction)) < proto->RequiredReputationRank)
+            return EQUIP_ERR_CANT_EQUIP_REPUTATION;
+
+        return EQUIP_ERR_OK;
+    }
+}
+
+#endif
@@ -56,6 +56,7 @@
 #include "OutdoorPvPMgr.h"
 #include "Pet.h"
 #include "Player.h"
+#include "PlayerItemUsability.h"
 #include "QueryHolder.h"
 #include "QuestDef.h"
 #include "ReputationMgr.h"
@@ -2242,6 +2243,11 @@ InventoryResult Player::CanBankItem(uint8 bag, uint8 slot, ItemPosCountVec& dest
     return EQUIP_ERR_BANK_FULL;
 }
 
+bool Player::IsHolidayActive(HolidayIds holiday) const
+{
+    return ::IsHolidayActive(holiday);
+}
+
 InventoryResult Player::CanUseItem(Item* pItem, bool not_loading) const
 {
     if (pItem)
@@ -2264,38 +2270,7 @@ InventoryResult Player::CanUseItem(Item* pItem, bool not_loading) const
             if (res != EQUIP_ERR_OK)
                 return res;
 
-            if (pItem->GetSkill() != 0)
-            {
-                bool allowEquip = false;
-                uint32 itemSkill = pItem->GetSkill();
-                // Armor that is binded to account can "morph" from plate to mail, etc. if skill is not learned yet.
-                if (pProto->Quality == ITEM_QUALITY_HEIRLOOM && pProto->Class == ITEM_CLASS_ARMOR && !HasSkill(itemSkill))
-                {
-                    /// @todo: when you right-click already equipped item it throws EQUIP_ERR_NO_REQUIRED_PROFICIENCY.
-
-                    // In fact it's a visual bug, everything works properly... I need sniffs of operations with
-                    // binded to account items from off server.
-
-                    switch (getClass())
-                    {
-                        case CLASS_HUNTER:
-                        case CLASS_SHAMAN:
-                            allowEquip = (itemSkill == SKILL_MAIL);
-                            break;
-                        case CLASS_PALADIN:
-                        case CLASS_WARRIOR:
-                            allowEquip = (itemSkill == SKILL_PLATE_MAIL);
-                            break;
-                    }
-                }
-                if (!allowEquip && GetSkillValue(itemSkill) == 0)
-                    return EQUIP_ERR_NO_REQUIRED_PROFICIENCY;
-            }
-
-            if (pProto->RequiredReputationFaction && uint32(GetReputationRank(pProto->RequiredReputationFaction)) < pProto->RequiredReputationRank)
-                return EQUIP_ERR_CANT_EQUIP_REPUTATION;
-
-            return EQUIP_ERR_OK;
+            return Acore::CanUseItemProficiency(*this, pProto);
         }
     }
     return EQUIP_ERR_ITEM_NOT_FOUND;
@@ -2310,51 +2285,12 @@ InventoryResult Player::CanUseItem(ItemTemplate const* proto) const
         return EQUIP_ERR_ITEM_NOT_FOUND;
     }
 
-    if ((proto->Flags2 & ITEM_FLAGS_EXTRA_HORDE_ONLY) && GetTeamId(true) != TEAM_HORDE)
-    {
-        return EQUIP_ERR_YOU_CAN_NEVER_USE_THAT_ITEM;
-    }
-
-    if ((proto->Flags2 & ITEM_FLAGS_EXTRA_ALLIANCE_ONLY) && GetTeamId(true) != TEAM_ALLIANCE)
+    InventoryResult result = Acore::CanUseItemTemplate(*this, proto);
+    if (result != EQUIP_ERR_OK)
     {
-        return EQUIP_ERR_YOU_CAN_NEVER_USE_THAT_ITEM;
-    }
-
-    if ((proto->AllowableClass & getClassMask()) == 0 || (proto->AllowableRace & getRaceMask()) == 0)
-    {
-        return EQUIP_ERR_YOU_CAN_NEVER_USE_THAT_ITEM;
-    }
-
-    if (proto->RequiredSkill != 0)
-    {
-        if (GetSkillValue(proto->RequiredSkill) == 0)
-        {
-            return EQUIP_ERR_NO_REQUIRED_PROFICIENCY;
-        }
-        else if (GetSkillValue(proto->RequiredSkill) < proto->RequiredSkillRank)
-        {
-            return EQUIP_ERR_CANT_EQUIP_SKILL;
-        }
-    }
-
-    if (proto->RequiredSpell != 0 && !HasSpell(proto->RequiredSpell))
-    {
-        return EQUIP_ERR_NO_REQUIRED_PROFICIENCY;
-    }
-
-    if (GetLevel() < proto->RequiredLevel)
-    {
-        return EQUIP_ERR_CANT_EQUIP_LEVEL_I;
-    }
-
-    // If World Event is not active, prevent using event dependant items
-    if (proto->HolidayId && !IsHolidayActive((HolidayIds)proto->HolidayId))
-    {
-        return EQUIP_ERR_CANT_DO_RIGHT_NOW;
+        return result;
     }
 
-    InventoryResult result = EQUIP_ERR_OK;
-
     if (!sScriptMgr->CanUseItem(const_cast<Player*>(this), proto, result))
     {
         return result;
@@ -43,7 +43,7 @@ bool PlayerSocial::AddToSocialList(ObjectGuid friendGuid, SocialFlag flag)
     if (GetNumberOfSocialsWithFlag(flag) >= (((flag & SOCIAL_FLAG_FRIEND) != 0) ? SOCIALMGR_FRIEND_LIMIT : SOCIALMGR_IGNORE_LIMIT))
         return false;
 
-    auto itr = m_playerSocialMap.find(friendGuid);
+    auto itr = _findContact(friendGuid);
     if (itr != m_playerSocialMap.end())
     {
         itr->second.Flags |= flag;
@@ -58,7 +58,7 @@ bool PlayerSocial::AddToSocialList(ObjectGuid friendGuid, SocialFlag flag)
     }
     else
     {
-        m_playerSocialMap[friendGuid].Flags |= flag;
+        _getOrAddContact(friendGuid).Flags |= flag;
 
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHARACTER_SOCIAL);
 
@@ -68,17 +68,24 @@ bool PlayerSocial::AddToSocialList(ObjectGuid friendGuid, SocialFlag flag)
 
         CharacterDatabase.Execute(stmt);
     }
+
+    if (flag & SOCIAL_FLAG_FRIEND)
+        sSocialMgr->_addFriendLister(friendGuid, GetPlayerGUID());
+
     return true;
 }
 
 void PlayerSocial::RemoveFromSocialList(ObjectGuid friendGuid, SocialFlag flag)
 {
-    auto itr = m_playerSocialMap.find(friendGuid);
+    auto itr = _findContact(friendGuid);
     if (itr == m_playerSocialMap.end())                     // not exist
         return;
 
     itr->second.Flags &= ~flag;
 
+    if (flag & SOCIAL_FLAG_FRIEND)
+        sSocialMgr->_removeFriendLister(friendGuid, GetPlayerGUID());
+
     if (itr->second.Flags == 0)
     {
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHARACTER_SOCIAL);
@@ -104,7 +111,7 @@ void PlayerSocial::RemoveFromSocialList(ObjectGuid friendGuid, SocialFlag flag)
 
 void PlayerSocial::SetFriendNote(ObjectGuid friendGuid, std::string note)
 {
-    auto itr = m_playerSocialMap.find(friendGuid);
+    auto itr = _findContact(friendGuid);
     if (itr == m_playerSocialMap.end())                     // not exist
         return;
 
@@ -118,7 +125,7 @@ void PlayerSocial::SetFriendNote(ObjectGuid friendGuid, std::string note)
 
     CharacterDatabase.Execute(stmt);
 
-    m_playerSocialMap[friendGuid].Note = note;
+    itr->second.Note = note;
 }
 
 void PlayerSocial::SendSocialList(Player* player, uint32 flags)
@@ -178,13 +185,39 @@ void PlayerSocial::SendSocialList(Player* player, uint32 flags)
 
 bool PlayerSocial::_checkContact(ObjectGuid guid, SocialFlag flags) const
 {
-    const auto& itr = m_playerSocialMap.find(guid);
+    auto itr = _findContact(guid);
     if (itr != m_playerSocialMap.end())
         return (itr->second.Flags & flags) != 0;
 
     return false;
 }
 
+static bool ContactGuidLess(std::pair<ObjectGuid, FriendInfo> const& contact, ObjectGuid guid)
+{
+    return contact.first < guid;
+}
+
+PlayerSocial::PlayerSocialMap::iterator PlayerSocial::_findContact(ObjectGuid guid)
+{
+    auto itr = std::lower_bound(m_playerSocialMap.begin(), m_playerSocialMap.end(), guid, ContactGuidLess);
+    return (itr != m_playerSocialMap.end() && itr->first == guid) ? itr : m_playerSocialMap.end();
+}
+
+PlayerSocial::PlayerSocialMap::const_iterator PlayerSocial::_findContact(ObjectGuid guid) const
+{
+    auto itr = std::lower_bound(m_playerSocialMap.begin(), m_playerSocialMap.end(), guid, ContactGuidLess);
+    return (itr != m_playerSocialMap.end() && itr->first == guid) ? itr : m_playerSocialMap.end();
+}
+
+FriendInfo& PlayerSocial::_getOrAddContact(ObjectGuid guid)
+{
+    auto itr = std::lower_bound(m_playerSocialMap.begin(), m_playerSocialMap.end(), guid, ContactGuidLess);
+    if (itr == m_playerSocialMap.end() || itr->first != guid)
+        itr = m_playerSocialMap.emplace(itr, guid, FriendInfo());
+
+    return itr->second;
+}
+
 bool PlayerSocial::HasFriend(ObjectGuid friend_guid) const
 {
     return _checkContact(friend_guid, SOCIAL_FLAG_FRIEND);
@@ -228,8 +261,9 @@ void SocialMgr::GetFriendInfo(Player* player, ObjectGuid friendGUID, FriendInfo&
     bool allowTwoSideWhoList = sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_WHO_LIST);
     AccountTypes gmLevelInWhoList = AccountTypes(sWorld->getIntConfig(CONFIG_GM_LEVEL_IN_WHO_LIST));
 
-    auto const& itr = player->GetSocial()->m_playerSocialMap.find(friendGUID);
-    if (itr != player->GetSocial()->m_playerSocialMap.end())
+    PlayerSocial const* social = player->GetSocial();
+    auto itr = social->_findContact(friendGUID);
+    if (itr != social->m_playerSocialMap.end())
         friendInfo.Note = itr->second.Note;
 
     // PLAYER see his team only and PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
@@ -301,21 +335,50 @@ void SocialMgr::BroadcastToFriendListers(Player* player, WorldPacket* packet)
     bool allowTwoSideWhoList = sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_WHO_LIST);
     AccountTypes gmLevelInWhoList = AccountTypes(sWorld->getIntConfig(CONFIG_GM_LEVEL_IN_WHO_LIST));
 
-    for (auto const& itr : m_socialMap)
+    auto listers = m_friendListers.find(player->GetGUID());
+    if (listers == m_friendListers.end())
+        return;
+
+    for (ObjectGuid const& listerGuid : listers->second)
     {
-        auto const& itr2 = itr.second.m_playerSocialMap.find(player->GetGUID());
-        if (itr2 != itr.second.m_playerSocialMap.end() && (itr2->second.Flags & SOCIAL_FLAG_FRIEND))
-        {
-            Player* pFriend = ObjectAccessor::FindPlayer(itr.first);
+        Player* pFriend = ObjectAccessor::FindPlayer(listerGuid);
 
-            // PLAYER see his team only and PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
-            // MODERATOR, GAME MASTER, ADMINISTRATOR can see all
-            if (pFriend && (!AccountMgr::IsPlayerAccount(pFriend->GetSession()->GetSecurity()) || ((pFriend->GetTeamId() == teamId || allowTwoSideWhoList) && security <= gmLevelInWhoList)) && player->IsVisibleGloballyFor(pFriend))
-                pFriend->GetSession()->SendPacket(packet);
-        }
+        // PLAYER see his team only and PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
+        // MODERATOR, GAME MASTER, ADMINISTRATOR can see all
+        if (pFriend && (!AccountMgr::IsPlayerAccount(pFriend->GetSession()->GetSecurity()) || ((pFriend->GetTeamId() == teamId || allowTwoSideWhoList) && security <= gmLevelInWhoList)) && player->IsVisibleGloballyFor(pFriend))
+            pFriend->GetSession()->SendPacket(packet);
     }
 }
 
+void SocialMgr::RemovePlayerSocial(ObjectGuid guid)
+{
+    auto itr = m_socialMap.find(guid);
+    if (itr == m_socialMap.end())
+        return;
+
+    for (auto const& [friendGuid, friendInfo] : itr->second.m_playerSocialMap)
+        if (friendInfo.Flags & SOCIAL_FLAG_FRIEND)
+            _removeFriendLister(friendGuid, guid);
+
+    m_socialMap.erase(itr);
+}
+
+void SocialMgr::_addFriendLister(ObjectGuid friendGuid, ObjectGuid lister)
+{
+    m_friendListers[friendGuid].insert(lister);
+}
+
+void SocialMgr::_removeFriendLister(ObjectGuid friendGuid, ObjectGuid lister)
+{
+    auto itr = m_friendListers.find(friendGuid);
+    if (itr == m_friendListers.end())
+        return;
+
+    itr->second.erase(lister);
+    if (itr->second.empty())
+        m_friendListers.erase(itr);
+}
+
 PlayerSocial* SocialMgr::LoadFromDB(PreparedQueryResult result, ObjectGuid guid)
 {
     PlayerSocial* social = &m_socialMap[guid];
@@ -332,7 +395,9 @@ PlayerSocial* SocialMgr::LoadFromDB(PreparedQueryResult result, ObjectGuid guid)
         auto flags = fields[1].Get<uint8>();
         auto note = fields[2].Get<std::string>();
 
-        social->m_playerSocialMap[friendGuid] = FriendInfo(flags, note);
+        social->_getOrAddContact(friendGuid) = FriendInfo(flags, note);
+        if (flags & SOCIAL_FLAG_FRIEND)
+            _addFriendLister(friendGuid, guid);
     } while (result->NextRow());
 
     return social;
@@ -21,7 +21,9 @@
 #include "Common.h"
 #include "DatabaseEnv.h"
 #include "ObjectGuid.h"
-#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 class Player;
 class WorldPacket;
@@ -117,14 +119,22 @@ class PlayerSocial
         void SetPlayerGUID(ObjectGuid guid) { m_playerGUID = guid; }
         uint32 GetNumberOfSocialsWithFlag(SocialFlag flag) const;
     private:
+        // Contacts sorted by guid, the lists are capped at a few dozen entries so a flat vector beats a tree
+        typedef std::vector<std::pair<ObjectGuid, FriendInfo>> PlayerSocialMap;
+
         bool _checkContact(ObjectGuid guid, SocialFlag flags) const;
-        typedef std::map<ObjectGuid, FriendInfo> PlayerSocialMap;
+        PlayerSocialMap::iterator _findContact(ObjectGuid guid);
+        PlayerSocialMap::const_iterator _findContact(ObjectGuid guid) const;
+        FriendInfo& _getOrAddContact(ObjectGuid guid);
+
         PlayerSocialMap m_playerSocialMap;
         ObjectGuid m_playerGUID;
 };
 
 class SocialMgr
 {
+    friend class PlayerSocial;
+
     private:
         SocialMgr();
         ~SocialMgr();
@@ -132,7 +142,7 @@ class SocialMgr
     public:
         static SocialMgr* instance();
         // Misc
-        void RemovePlayerSocial(ObjectGuid guid) { m_socialMap.erase(guid); }
+        void RemovePlayerSocial(ObjectGuid guid);
         static void GetFriendInfo(Player* player, ObjectGuid friendGUID, FriendInfo& friendInfo);
         // Packet management
         void MakeFriendStatusPacket(FriendsResult result, ObjectGuid friend_guid, WorldPacket* data);
@@ -141,8 +151,13 @@ class SocialMgr
         // Loading
         PlayerSocial* LoadFromDB(PreparedQueryResult result, ObjectGuid guid);
     private:
-        typedef std::map<ObjectGuid, PlayerSocial> SocialMap;
+        void _addFriendLister(ObjectGuid friendGuid, ObjectGuid lister);
+        void _removeFriendLister(ObjectGuid friendGuid, ObjectGuid lister);
+
+        typedef std::unordered_map<ObjectGuid, PlayerSocial> SocialMap;
         SocialMap m_socialMap;
+        // Reverse index of m_socialMap: player -> loaded players that list that player as a friend
+        std::unordered_map<ObjectGuid, std::unordered_set<ObjectGuid>> m_friendListers;
 };
 
 #define sSocialMgr SocialMgr::instance()
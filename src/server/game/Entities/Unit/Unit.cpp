@@ -262,6 +262,10 @@ Unit::Unit(bool isWorldObject) : WorldObject(isWorldObject),
     m_auraUpdateIterator = m_ownedAuras.end();
 
     m_interruptMask = 0;
+    memset(m_procAuraFlagCounts, 0, sizeof(m_procAuraFlagCounts));
+    m_procAuraFlags = 0;
+    m_alwaysCheckedProcAurasCount = 0;
+    m_procAurasVersion = sSpellMgr->GetProcDataVersion();
     m_transform = 0;
     m_canModifyStats = false;
 
@@ -4426,6 +4430,8 @@ AuraApplication* Unit::_CreateAuraApplication(Aura* aura, uint8 effMask)
     if (AuraStateType aState = aura->GetSpellInfo()->GetAuraState())
         m_auraStateAuras.insert(AuraStateAurasMap::value_type(aState, aurApp));
 
+    _AddProcAura(aurApp);
+
     aura->_ApplyForTarget(this, caster, aurApp);
     return aurApp;
 }
@@ -4518,6 +4524,8 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMo
     // Remove all pointers from lists here to prevent possible pointer invalidation on spellcast/auraapply/auraremove
     m_appliedAuras.erase(i);
 
+    _RemoveProcAura(aurApp);
+
     // xinef: do not insert our application to interruptible list if application target is not the owner (area auras)
     // xinef: event if it gets removed, it will be reapplied in a second
     if (aura->GetSpellInfo()->AuraInterruptFlags && this == aura->GetOwner())
@@ -4579,6 +4587,67 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMo
     sScriptMgr->OnAuraRemove(this, aurApp, removeMode);
 }
 
+void Unit::_AddProcAura(AuraApplication* aurApp)
+{
+    uint32 procFlags = aurApp->GetProcFlags();
+    bool alwaysChecked = aurApp->IsAlwaysCheckingProc();
+    if (!procFlags && !alwaysChecked)
+        return;
+
+    m_procAuras.insert(AuraApplicationMap::value_type(aurApp->GetBase()->GetId(), aurApp));
+
+    for (uint8 i = 0; i < 32; ++i)
+        if (procFlags & (1 << i))
+            ++m_procAuraFlagCounts[i];
+
+    m_procAuraFlags |= procFlags;
+
+    if (alwaysChecked)
+        ++m_alwaysCheckedProcAurasCount;
+}
+
+void Unit::_RemoveProcAura(AuraApplication* aurApp)
+{
+    uint32 procFlags = aurApp->GetProcFlags();
+    bool alwaysChecked = aurApp->IsAlwaysCheckingProc();
+    if (!procFlags && !alwaysChecked)
+        return;
+
+    AuraApplicationMapBoundsNonConst range = m_procAuras.equal_range(aurApp->GetBase()->GetId());
+    for (AuraApplicationMap::iterator itr = range.first; itr != range.second; ++itr)
+    {
+        if (itr->second == aurApp)
+        {
+            m_procAuras.erase(itr);
+            break;
+        }
+    }
+
+    for (uint8 i = 0; i < 32; ++i)
+        if (procFlags & (1 << i))
+            if (!--m_procAuraFlagCounts[i])
+                m_procAuraFlags &= ~(1 << i);
+
+    if (alwaysChecked)
+        --m_alwaysCheckedProcAurasCount;
+}
+
+// Proc flags of applied auras are resolved when they are applied, rebuild the index with the data of a spell_proc_event or spell_proc reload
+void Unit::_RebuildProcAuras()
+{
+    m_procAuras.clear();
+    memset(m_procAuraFlagCounts, 0, sizeof(m_procAuraFlagCounts));
+    m_procAuraFlags = 0;
+    m_alwaysCheckedProcAurasCount = 0;
+    m_procAurasVersion = sSpellMgr->GetProcDataVersion();
+
+    for (AuraApplicationMap::value_type const& pair : m_appliedAuras)
+    {
+        pair.second->UpdateProcFlags();
+        _AddProcAura(pair.second);
+    }
+}
+
 void Unit::_UnapplyAura(AuraApplication* aurApp, AuraRemoveMode removeMode)
 {
     // aura can be removed from unit only if it's applied on it, shouldn't happen
@@ -16462,9 +16531,18 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
     ProcEventInfo eventInfo = ProcEventInfo(actor, actionTarget, target, procFlag, 0, procPhase, procExtra, procSpell, damageInfo, healInfo, procAura, procAuraEffectIndex);
 
     ProcTriggeredList procTriggered;
-    // Fill procTriggered list
-    for (AuraApplicationMap::const_iterator itr = GetAppliedAuras().begin(); itr != GetAppliedAuras().end(); ++itr)
+    // Fill procTriggered list, only auras of the proc index listening to one of the event flags can trigger
+    if (m_procAurasVersion != sSpellMgr->GetProcDataVersion())
+        _RebuildProcAuras();
+
+    if (!(procFlag & m_procAuraFlags) && !m_alwaysCheckedProcAurasCount)
+        return;
+
+    for (AuraApplicationMap::const_iterator itr = m_procAuras.begin(); itr != m_procAuras.end(); ++itr)
     {
+        if (!(itr->second->GetProcFlags() & procFlag) && !itr->second->IsAlwaysCheckingProc())
+            continue;
+
         // Do not allow auras to proc from effect triggered by itself
         if (procAura && procAura->Id == itr->first)
             continue;
@@ -17749,12 +17827,8 @@ bool Unit::IsTriggeredAtSpellProcEvent(Unit* victim, Aura* aura, WeaponAttackTyp
     // Get proc Event Entry
     spellProcEvent = sSpellMgr->GetSpellProcEvent(spellProto->Id);
 
-    // Get EventProcFlag
-    uint32 EventProcFlag;
-    if (spellProcEvent && spellProcEvent->procFlags) // if exist get custom spellProcEvent->procFlags
-        EventProcFlag = spellProcEvent->procFlags;
-    else
-        EventProcFlag = spellProto->ProcFlags;       // else get from spell proto
+    // Get EventProcFlag, custom spellProcEvent->procFlags if exist else from spell proto
+    uint32 EventProcFlag = sSpellMgr->GetSpellProcEventFlags(spellProto->Id);
     // Continue if no trigger exist
     if (!EventProcFlag)
         return false;
@@ -1917,6 +1917,9 @@ public:
     void _ApplyAura(AuraApplication* aurApp, uint8 effMask);
     void _UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMode);
     void _UnapplyAura(AuraApplication* aurApp, AuraRemoveMode removeMode);
+    void _AddProcAura(AuraApplication* aurApp);
+    void _RemoveProcAura(AuraApplication* aurApp);
+    void _RebuildProcAuras();
     void _RemoveNoStackAuraApplicationsDueToAura(Aura* aura);
     void _RemoveNoStackAurasDueToAura(Aura* aura);
     bool _IsNoStackAuraDueToAura(Aura* appliedAura, Aura* existingAura) const;
@@ -2524,6 +2527,13 @@ protected:
     AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
     uint32 m_interruptMask;
 
+    // Proc index: applied auras that can react to proc events, kept in the same order as m_appliedAuras
+    AuraApplicationMap m_procAuras;
+    uint16 m_procAuraFlagCounts[32];           // number of m_procAuras listening to each proc flag bit
+    uint32 m_procAuraFlags;                    // union of the proc flags of m_procAuras
+    uint32 m_alwaysCheckedProcAurasCount;      // m_procAuras with CheckProc script hooks, checked on every event
+    uint32 m_procAurasVersion;                 // SpellMgr proc data version the proc flags of m_procAuras were resolved with
+
     float m_auraModifiersGroup[UNIT_MOD_END][MODIFIER_TYPE_END];
     float m_weaponDamage[MAX_ATTACK][MAX_WEAPON_DAMAGE_RANGE][MAX_ITEM_PROTO_DAMAGES];
     bool m_canModifyStats;
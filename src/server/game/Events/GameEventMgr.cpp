@@ -24,6 +24,7 @@
 #include "Language.h"
 #include "Log.h"
 #include "MapMgr.h"
+#include "Metric.h"
 #include "ObjectMgr.h"
 #include "Player.h"
 #include "PoolMgr.h"
@@ -1206,6 +1207,8 @@ uint32 GameEventMgr::Update()                               // return the next e
 
 void GameEventMgr::UnApplyEvent(uint16 event_id)
 {
+    METRIC_TIMER("game_event_transition_time", METRIC_TAG("event", std::to_string(event_id)), METRIC_TAG("type", "stop"));
+
     LOG_DEBUG("gameevent", "GameEvent {} \"{}\" removed.", event_id, mGameEvent[event_id].description);
     //! Run SAI scripts with SMART_EVENT_GAME_EVENT_END
     RunSmartAIScripts(event_id, false);
@@ -1229,6 +1232,8 @@ void GameEventMgr::UnApplyEvent(uint16 event_id)
 
 void GameEventMgr::ApplyNewEvent(uint16 event_id)
 {
+    METRIC_TIMER("game_event_transition_time", METRIC_TAG("event", std::to_string(event_id)), METRIC_TAG("type", "start"));
+
     uint8 announce = mGameEvent[event_id].announce;
     if (announce == 1 || (announce == 2 && sWorld->getIntConfig(CONFIG_EVENT_ANNOUNCE)))
         sWorld->SendWorldText(LANG_EVENTMESSAGE, mGameEvent[event_id].description.c_str());
@@ -1328,6 +1333,12 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
         return;
     }
 
+    // with GameEvent.SpawnsPerMapUpdate the objects are created by the maps' own updates, spread over several ticks
+    bool queueSpawns = sWorld->getIntConfig(CONFIG_GAME_EVENT_SPAWNS_PER_MAP_UPDATE) > 0;
+    uint32 queuedSpawns = 0;
+    // event spawns are mostly grouped by map, avoid a MapMgr lookup per spawn
+    Map* map = nullptr;
+
     for (GuidLowList::iterator itr = mGameEventCreatureGuids[internal_event_id].begin(); itr != mGameEventCreatureGuids[internal_event_id].end(); ++itr)
     {
         // Add to correct cell
@@ -1336,10 +1347,18 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
             sObjectMgr->AddCreatureToGrid(*itr, data);
 
             // Spawn if necessary (loaded grids only)
-            Map* map = sMapMgr->CreateBaseMap(data->mapid);
+            if (!map || map->GetId() != data->mapid)
+                map = sMapMgr->CreateBaseMap(data->mapid);
             // We use spawn coords to spawn
             if (!map->Instanceable() && map->IsGridLoaded(data->posX, data->posY))
             {
+                if (queueSpawns)
+                {
+                    map->QueueCreatureSpawn(*itr, event_id > 0 ? event_id : 0);
+                    ++queuedSpawns;
+                    continue;
+                }
+
                 Creature* creature = new Creature;
                 if (!creature->LoadCreatureFromDB(*itr, map))
                     delete creature;
@@ -1362,10 +1381,18 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
             sObjectMgr->AddGameobjectToGrid(*itr, data);
             // Spawn if necessary (loaded grids only)
             // this base map checked as non-instanced and then only existed
-            Map* map = sMapMgr->CreateBaseMap(data->mapid);
+            if (!map || map->GetId() != data->mapid)
+                map = sMapMgr->CreateBaseMap(data->mapid);
             // We use current coords to unspawn, not spawn coords since creature can have changed grid
             if (!map->Instanceable() && map->IsGridLoaded(data->posX, data->posY))
             {
+                if (queueSpawns)
+                {
+                    map->QueueGameObjectSpawn(*itr, event_id > 0 ? event_id : 0);
+                    ++queuedSpawns;
+                    continue;
+                }
+
                 GameObject* pGameobject = sObjectMgr->IsGameObjectStaticTransport(data->id) ? new StaticTransport() : new GameObject();
                 //TODO: find out when it is add to map
                 if (!pGameobject->LoadGameObjectFromDB(*itr, map, false))
@@ -1388,6 +1415,12 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
 
     for (IdList::iterator itr = mGameEventPoolIds[internal_event_id].begin(); itr != mGameEventPoolIds[internal_event_id].end(); ++itr)
         sPoolMgr->SpawnPool(*itr);
+
+    if (queuedSpawns)
+    {
+        LOG_DEBUG("gameevent", "GameEvent {} queued {} spawns to the map updates.", event_id, queuedSpawns);
+        METRIC_VALUE("game_event_queued_spawns", queuedSpawns, METRIC_TAG("event", std::to_string(event_id)));
+    }
 }
 
 void GameEventMgr::GameEventUnspawn(int16 event_id)
@@ -1401,6 +1434,8 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
         return;
     }
 
+    // despawns are collected per map, so every map is walked once instead of once per spawn
+    std::unordered_map<uint32 /*mapId*/, std::vector<ObjectGuid::LowType>> creaturesByMap;
     for (GuidLowList::iterator itr = mGameEventCreatureGuids[internal_event_id].begin(); itr != mGameEventCreatureGuids[internal_event_id].end(); ++itr)
     {
         // check if it's needed by another event, if so, don't remove
@@ -1411,18 +1446,25 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
         if (CreatureData const* data = sObjectMgr->GetCreatureData(*itr))
         {
             sObjectMgr->RemoveCreatureFromGrid(*itr, data);
+            creaturesByMap[data->mapid].push_back(*itr);
+        }
+    }
 
-            sMapMgr->DoForAllMapsWithMapId(data->mapid, [&itr](Map* map)
+    for (auto const& [mapId, spawnIds] : creaturesByMap)
+    {
+        sMapMgr->DoForAllMapsWithMapId(mapId, [&spawnIds](Map* map)
+        {
+            for (ObjectGuid::LowType spawnId : spawnIds)
             {
-                auto creatureBounds = map->GetCreatureBySpawnIdStore().equal_range(*itr);
+                auto creatureBounds = map->GetCreatureBySpawnIdStore().equal_range(spawnId);
                 for (auto itr2 = creatureBounds.first; itr2 != creatureBounds.second;)
                 {
                     Creature* creature = itr2->second;
                     ++itr2;
                     creature->AddObjectToRemoveList();
                 }
-            });
-        }
+            }
+        });
     }
 
     if (internal_event_id >= int32(mGameEventGameobjectGuids.size()))
@@ -1432,6 +1474,7 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
         return;
     }
 
+    std::unordered_map<uint32 /*mapId*/, std::vector<ObjectGuid::LowType>> gameobjectsByMap;
     for (GuidLowList::iterator itr = mGameEventGameobjectGuids[internal_event_id].begin(); itr != mGameEventGameobjectGuids[internal_event_id].end(); ++itr)
     {
         // check if it's needed by another event, if so, don't remove
@@ -1441,18 +1484,25 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
         if (GameObjectData const* data = sObjectMgr->GetGameObjectData(*itr))
         {
             sObjectMgr->RemoveGameobjectFromGrid(*itr, data);
+            gameobjectsByMap[data->mapid].push_back(*itr);
+        }
+    }
 
-            sMapMgr->DoForAllMapsWithMapId(data->mapid, [&itr](Map* map)
+    for (auto const& [mapId, spawnIds] : gameobjectsByMap)
+    {
+        sMapMgr->DoForAllMapsWithMapId(mapId, [&spawnIds](Map* map)
+        {
+            for (ObjectGuid::LowType spawnId : spawnIds)
             {
-                auto gameobjectBounds = map->GetGameObjectBySpawnIdStore().equal_range(*itr);
+                auto gameobjectBounds = map->GetGameObjectBySpawnIdStore().equal_range(spawnId);
                 for (auto itr2 = gameobjectBounds.first; itr2 != gameobjectBounds.second;)
                 {
                     GameObject* go = itr2->second;
                     ++itr2;
                     go->AddObjectToRemoveList();
                 }
-            });
-        }
+            }
+        });
     }
     if (internal_event_id >= int32(mGameEventPoolIds.size()))
     {
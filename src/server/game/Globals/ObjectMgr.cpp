@@ -52,6 +52,7 @@
 #include "Util.h"
 #include "Vehicle.h"
 #include "World.h"
+#include "WorldDataCache.h"
 #include "StringConvert.h"
 #include "Tokenize.h"
 #include <boost/algorithm/string.hpp>
@@ -2140,26 +2141,81 @@ void ObjectMgr::LoadTempSummons()
     LOG_INFO("server.loading", " ");
 }
 
-void ObjectMgr::LoadCreatures()
-{
-    uint32 oldMSTime = getMSTime();
+namespace
+{
+    /// Row of the `creature` spawn query before any validation, as stored in the world data cache
+    struct CreatureSpawnRow
+    {
+        ObjectGuid::LowType SpawnId;
+        uint32 Id1;
+        uint32 Id2;
+        uint32 Id3;
+        uint16 MapId;
+        int8 EquipmentId;
+        float PosX;
+        float PosY;
+        float PosZ;
+        float Orientation;
+        uint32 SpawnTimeSecs;
+        float WanderDistance;
+        uint32 CurrentWaypoint;
+        uint32 CurHealth;
+        uint32 CurMana;
+        uint8 MovementType;
+        uint8 SpawnMask;
+        uint32 PhaseMask;
+        int16 GameEvent;
+        uint32 PoolId;
+        uint32 NpcFlag;
+        uint32 UnitFlags;
+        uint32 DynamicFlags;
+        std::string ScriptName;
+    };
 
-    //                                                     0         1    2    3    4        5            6           7           8            9              10            11
-    QueryResult result = WorldDatabase.Query("SELECT creature.guid, id1, id2, id3, map, equipment_id, position_x, position_y, position_z, orientation, spawntimesecs, wander_distance, "
-                         //      12            13       14          15           16         17         18          19             20                 21                    22
-                         "currentwaypoint, curhealth, curmana, MovementType, spawnMask, phaseMask, eventEntry, pool_entry, creature.npcflag, creature.unit_flags, creature.dynamicflags, "
-                         //       23
-                         "creature.ScriptName "
-                         "FROM creature "
-                         "LEFT OUTER JOIN game_event_creature ON creature.guid = game_event_creature.guid "
-                         "LEFT OUTER JOIN pool_creature ON creature.guid = pool_creature.guid");
+    ByteBuffer& operator<<(ByteBuffer& data, CreatureSpawnRow const& row)
+    {
+        data << row.SpawnId << row.Id1 << row.Id2 << row.Id3 << row.MapId << row.EquipmentId;
+        data << row.PosX << row.PosY << row.PosZ << row.Orientation << row.SpawnTimeSecs << row.WanderDistance;
+        data << row.CurrentWaypoint << row.CurHealth << row.CurMana << row.MovementType << row.SpawnMask << row.PhaseMask;
+        data << row.GameEvent << row.PoolId << row.NpcFlag << row.UnitFlags << row.DynamicFlags << row.ScriptName;
+        return data;
+    }
 
-    if (!result)
+    ByteBuffer& operator>>(ByteBuffer& data, CreatureSpawnRow& row)
     {
-        LOG_WARN("server.loading", ">> Loaded 0 creatures. DB table `creature` is empty.");
-        LOG_INFO("server.loading", " ");
-        return;
+        data >> row.SpawnId >> row.Id1 >> row.Id2 >> row.Id3 >> row.MapId >> row.EquipmentId;
+        data >> row.PosX >> row.PosY >> row.PosZ >> row.Orientation >> row.SpawnTimeSecs >> row.WanderDistance;
+        data >> row.CurrentWaypoint >> row.CurHealth >> row.CurMana >> row.MovementType >> row.SpawnMask >> row.PhaseMask;
+        data >> row.GameEvent >> row.PoolId >> row.NpcFlag >> row.UnitFlags >> row.DynamicFlags >> row.ScriptName;
+        return data;
+    }
+
+    bool LoadCreatureSpawnRowsFromCache(std::string const& cacheKey, std::vector<CreatureSpawnRow>& rows)
+    {
+        ByteBuffer cached;
+        if (!WorldDataCache::Load("creature", cacheKey, cached))
+            return false;
+
+        try
+        {
+            rows.resize(cached.read<uint32>());
+            for (CreatureSpawnRow& row : rows)
+                cached >> row;
+        }
+        catch (ByteBufferException const&)
+        {
+            LOG_ERROR("server.loading", "World data cache for `creature` is corrupted, loading from database.");
+            rows.clear();
+            return false;
+        }
+
+        return true;
     }
+}
+
+void ObjectMgr::LoadCreatures()
+{
+    uint32 oldMSTime = getMSTime();
 
     // Build single time for check spawnmask
     std::map<uint32, uint32> spawnMasks;
@@ -2169,64 +2225,61 @@ void ObjectMgr::LoadCreatures()
                 if (GetMapDifficultyData(i, Difficulty(k)))
                     spawnMasks[i] |= (1 << k);
 
-    _creatureDataStore.rehash(result->GetRowCount());
-    uint32 count = 0;
-    do
+    // Validates one row and stores it, returns false if the row was skipped
+    auto loadCreature = [&](CreatureSpawnRow const& row) -> bool
     {
-        Field* fields = result->Fetch();
-
-        ObjectGuid::LowType spawnId     = fields[0].Get<uint32>();
-        uint32 id1                      = fields[1].Get<uint32>();
-        uint32 id2                      = fields[2].Get<uint32>();
-        uint32 id3                      = fields[3].Get<uint32>();
+        ObjectGuid::LowType spawnId     = row.SpawnId;
+        uint32 id1                      = row.Id1;
+        uint32 id2                      = row.Id2;
+        uint32 id3                      = row.Id3;
 
         CreatureTemplate const* cInfo = GetCreatureTemplate(id1);
         if (!cInfo)
         {
             LOG_ERROR("sql.sql", "Table `creature` has creature (SpawnId: {}) with non existing creature entry {} in id1 field, skipped.", spawnId, id1);
-            continue;
+            return false;
         }
         CreatureTemplate const* cInfo2 = GetCreatureTemplate(id2);
         if (!cInfo2 && id2)
         {
             LOG_ERROR("sql.sql", "Table `creature` has creature (SpawnId: {}) with non existing creature entry {} in id2 field, skipped.", spawnId, id2);
-            continue;
+            return false;
         }
         CreatureTemplate const* cInfo3 = GetCreatureTemplate(id3);
         if (!cInfo3 && id3)
         {
             LOG_ERROR("sql.sql", "Table `creature` has creature (SpawnId: {}) with non existing creature entry {} in id3 field, skipped.", spawnId, id3);
-            continue;
+            return false;
         }
         if (!id2 && id3)
         {
             LOG_ERROR("sql.sql", "Table `creature` has creature (SpawnId: {}) with creature entry {} in id3 field but no entry in id2 field, skipped.", spawnId, id3);
-            continue;
+            return false;
         }
         CreatureData& data      = _creatureDataStore[spawnId];
         data.id1                = id1;
         data.id2                = id2;
         data.id3                = id3;
-        data.mapid              = fields[4].Get<uint16>();
-        data.equipmentId        = fields[5].Get<int8>();
-        data.posX               = fields[6].Get<float>();
-        data.posY               = fields[7].Get<float>();
-        data.posZ               = fields[8].Get<float>();
-        data.orientation        = fields[9].Get<float>();
-        data.spawntimesecs      = fields[10].Get<uint32>();
-        data.wander_distance    = fields[11].Get<float>();
-        data.currentwaypoint    = fields[12].Get<uint32>();
-        data.curhealth          = fields[13].Get<uint32>();
-        data.curmana            = fields[14].Get<uint32>();
-        data.movementType       = fields[15].Get<uint8>();
-        data.spawnMask          = fields[16].Get<uint8>();
-        data.phaseMask          = fields[17].Get<uint32>();
-        int16 gameEvent         = fields[18].Get<int8>();
-        uint32 PoolId           = fields[19].Get<uint32>();
-        data.npcflag            = fields[20].Get<uint32>();
-        data.unit_flags         = fields[21].Get<uint32>();
-        data.dynamicflags       = fields[22].Get<uint32>();
-        data.ScriptId           = GetScriptId(fields[23].Get<std::string>());
+        data.mapid              = row.MapId;
+        data.equipmentId        = row.EquipmentId;
+        data.posX               = row.PosX;
+        data.posY               = row.PosY;
+        data.posZ               = row.PosZ;
+        data.orientation        = row.Orientation;
+        data.spawntimesecs      = row.SpawnTimeSecs;
+        data.wander_distance    = row.WanderDistance;
+        data.currentwaypoint    = row.CurrentWaypoint;
+        data.curhealth          = row.CurHealth;
+        data.curmana            = row.CurMana;
+        data.movementType       = row.MovementType;
+        data.spawnMask          = row.SpawnMask;
+        data.phaseMask          = row.PhaseMask;
+        int16 gameEvent         = row.GameEvent;
+        uint32 PoolId           = row.PoolId;
+        data.npcflag            = row.NpcFlag;
+        data.unit_flags         = row.UnitFlags;
+        data.dynamicflags       = row.DynamicFlags;
+        data.ScriptId           = GetScriptId(row.ScriptName);
 
         if (!data.ScriptId)
             data.ScriptId = cInfo->ScriptID;
@@ -2235,7 +2288,7 @@ void ObjectMgr::LoadCreatures()
         if (!mapEntry)
         {
             LOG_ERROR("sql.sql", "Table `creature` have creature (SpawnId: {}) that spawned at not existed map (Id: {}), skipped.", spawnId, data.mapid);
-            continue;
+            return false;
         }
 
         // pussywizard: 7 days means no reaspawn, so set it to 14 days, because manual id reset may be late
@@ -2258,7 +2311,7 @@ void ObjectMgr::LoadCreatures()
             }
         }
         if (!ok)
-            continue;
+            return false;
 
         // -1 random, 0 no equipment,
         if (data.equipmentId != 0)
@@ -2328,8 +2381,93 @@ void ObjectMgr::LoadCreatures()
         if (gameEvent == 0 && PoolId == 0)
             AddCreatureToGrid(spawnId, &data);
 
-        ++count;
-    } while (result->NextRow());
+        return true;
+    };
+
+    uint32 count = 0;
+    std::vector<CreatureSpawnRow> cachedRows;
+    std::string const cacheKey = WorldDataCache::GetTablesKey("creature,game_event_creature,pool_creature");
+    if (LoadCreatureSpawnRowsFromCache(cacheKey, cachedRows))
+    {
+        LOG_INFO("server.loading", ">> Using world data cache for `creature` ({} rows)", cachedRows.size());
+
+        _creatureDataStore.rehash(cachedRows.size());
+        for (CreatureSpawnRow const& row : cachedRows)
+            if (loadCreature(row))
+                ++count;
+    }
+    else
+    {
+        //                                                     0         1    2    3    4        5            6           7           8            9              10            11
+        // streamed: every row is validated and stored as soon as it arrives, the result is never held in memory
+        QueryResult result = WorldDatabase.StreamQuery("SELECT creature.guid, id1, id2, id3, map, equipment_id, position_x, position_y, position_z, orientation, spawntimesecs, wander_distance, "
+                             //      12            13       14          15           16         17         18          19             20                 21                    22
+                             "currentwaypoint, curhealth, curmana, MovementType, spawnMask, phaseMask, eventEntry, pool_entry, creature.npcflag, creature.unit_flags, creature.dynamicflags, "
+                             //       23
+                             "creature.ScriptName "
+                             "FROM creature "
+                             "LEFT OUTER JOIN game_event_creature ON creature.guid = game_event_creature.guid "
+                             "LEFT OUTER JOIN pool_creature ON creature.guid = pool_creature.guid");
+
+        if (!result)
+        {
+            LOG_WARN("server.loading", ">> Loaded 0 creatures. DB table `creature` is empty.");
+            LOG_INFO("server.loading", " ");
+            return;
+        }
+
+        // the snapshot is only built when the cache is enabled, rows are serialized as they stream in
+        ByteBuffer cached;
+        uint32 rowCount = 0;
+        if (!cacheKey.empty())
+            cached << uint32(0);
+
+        CreatureSpawnRow row;
+        do
+        {
+            Field* fields = result->Fetch();
+
+            row.SpawnId           = fields[0].Get<uint32>();
+            row.Id1               = fields[1].Get<uint32>();
+            row.Id2               = fields[2].Get<uint32>();
+            row.Id3               = fields[3].Get<uint32>();
+            row.MapId             = fields[4].Get<uint16>();
+            row.EquipmentId       = fields[5].Get<int8>();
+            row.PosX              = fields[6].Get<float>();
+            row.PosY              = fields[7].Get<float>();
+            row.PosZ              = fields[8].Get<float>();
+            row.Orientation       = fields[9].Get<float>();
+            row.SpawnTimeSecs     = fields[10].Get<uint32>();
+            row.WanderDistance    = fields[11].Get<float>();
+            row.CurrentWaypoint   = fields[12].Get<uint32>();
+            row.CurHealth         = fields[13].Get<uint32>();
+            row.CurMana           = fields[14].Get<uint32>();
+            row.MovementType      = fields[15].Get<uint8>();
+            row.SpawnMask         = fields[16].Get<uint8>();
+            row.PhaseMask         = fields[17].Get<uint32>();
+            row.GameEvent         = fields[18].Get<int8>();
+            row.PoolId            = fields[19].Get<uint32>();
+            row.NpcFlag           = fields[20].Get<uint32>();
+            row.UnitFlags         = fields[21].Get<uint32>();
+            row.DynamicFlags      = fields[22].Get<uint32>();
+            row.ScriptName        = fields[23].Get<std::string>();
+
+            if (!cacheKey.empty())
+            {
+                cached << row;
+                ++rowCount;
+            }
+
+            if (loadCreature(row))
+                ++count;
+        } while (result->NextRow());
+
+        if (!cacheKey.empty())
+        {
+            cached.put<uint32>(0, rowCount);
+            WorldDataCache::Save("creature", cacheKey, cached);
+        }
+    }
 
     LOG_INFO("server.loading", ">> Loaded {} Creatures in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
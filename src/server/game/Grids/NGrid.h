@@ -38,7 +38,7 @@ class NGrid
 public:
     typedef Grid<ACTIVE_OBJECT, WORLD_OBJECT_TYPES, GRID_OBJECT_TYPES> GridType;
     NGrid(uint32 id, int32 x, int32 y)
-        : i_gridId(id), i_x(x), i_y(y), i_GridObjectDataLoaded(false)
+        : i_gridId(id), i_x(x), i_y(y), i_GridObjectDataLoaded(false), i_idleTime(0)
     {
     }
 
@@ -65,6 +65,10 @@ public:
     [[nodiscard]] bool isGridObjectDataLoaded() const { return i_GridObjectDataLoaded; }
     void setGridObjectDataLoaded(bool pLoaded) { i_GridObjectDataLoaded = pLoaded; }
 
+    // time in ms the grid has been out of reach of players and active objects
+    [[nodiscard]] uint32 GetIdleTime() const { return i_idleTime; }
+    void SetIdleTime(uint32 idleTime) { i_idleTime = idleTime; }
+
     /*
     template<class SPECIFIC_OBJECT> void AddWorldObject(const uint32 x, const uint32 y, SPECIFIC_OBJECT *obj)
     {
@@ -110,5 +114,6 @@ private:
     int32 i_y;
     GridType i_cells[N][N];
     bool i_GridObjectDataLoaded;
+    uint32 i_idleTime;
 };
 #endif
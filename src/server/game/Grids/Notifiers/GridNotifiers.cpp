@@ -24,6 +24,7 @@
 #include "Transport.h"
 #include "UpdateData.h"
 #include "WorldPacket.h"
+#include <algorithm>
 
 using namespace Acore;
 
@@ -277,6 +278,25 @@ void MessageDistDeliverer::Visit(DynamicObjectMapType& m)
     }
 }
 
+// A player riding a vehicle while seeing through a shared vision target in range is
+// collected twice, so the recipient list is made unique before anything is sent
+static void DeliverToRecipients(std::vector<Player*>& recipients, WorldPacket const* message)
+{
+    std::sort(recipients.begin(), recipients.end());
+    recipients.erase(std::unique(recipients.begin(), recipients.end()), recipients.end());
+
+    LazySharedWorldPacket sharedMessage(message);
+    for (Player* player : recipients)
+        player->GetSession()->SendPacket(sharedMessage.Get());
+
+    recipients.clear();
+}
+
+void MessageDistDeliverer::Deliver()
+{
+    DeliverToRecipients(i_recipients, i_message);
+}
+
 void MessageDistDelivererToHostile::Visit(PlayerMapType& m)
 {
     for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
@@ -339,6 +359,11 @@ void MessageDistDelivererToHostile::Visit(DynamicObjectMapType& m)
     }
 }
 
+void MessageDistDelivererToHostile::Deliver()
+{
+    DeliverToRecipients(i_recipients, i_message);
+}
+
 template<class T>
 void ObjectUpdater::Visit(GridRefMgr<T>& m)
 {
@@ -102,6 +102,7 @@ namespace Acore
         float i_distSq;
         TeamId teamId;
         Player const* skipped_receiver;
+        std::vector<Player*> i_recipients; // collected while visiting the cells, the packet is sent by Deliver()
         MessageDistDeliverer(WorldObject const* src, WorldPacket const* msg, float dist, bool own_team_only = false, Player const* skipped = nullptr)
             : i_source(src), i_message(msg), i_phaseMask(src->GetPhaseMask()), i_distSq(dist * dist)
             , teamId((own_team_only && src->GetTypeId() == TYPEID_PLAYER) ? src->ToPlayer()->GetTeamId() : TEAM_NEUTRAL)
@@ -122,8 +123,10 @@ namespace Acore
             if (!player->HaveAtClient(i_source))
                 return;
 
-            player->GetSession()->SendPacket(i_message);
+            i_recipients.push_back(player);
         }
+
+        void Deliver();
     };
 
     struct MessageDistDelivererToHostile
@@ -132,6 +135,7 @@ namespace Acore
         WorldPacket* i_message;
         uint32 i_phaseMask;
         float i_distSq;
+        std::vector<Player*> i_recipients;
         MessageDistDelivererToHostile(Unit* src, WorldPacket* msg, float dist)
             : i_source(src), i_message(msg), i_phaseMask(src->GetPhaseMask()), i_distSq(dist * dist)
         {
@@ -147,8 +151,10 @@ namespace Acore
             if (player == i_source || !player->HaveAtClient(i_source) || player->IsFriendlyTo(i_source))
                 return;
 
-            player->GetSession()->SendPacket(i_message);
+            i_recipients.push_back(player);
         }
+
+        void Deliver();
     };
 
     struct ObjectUpdater
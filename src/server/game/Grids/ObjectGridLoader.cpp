@@ -245,3 +245,36 @@ template void ObjectGridCleaner::Visit(CreatureMapType&);
 template void ObjectGridCleaner::Visit<GameObject>(GameObjectMapType&);
 template void ObjectGridCleaner::Visit<DynamicObject>(DynamicObjectMapType&);
 template void ObjectGridCleaner::Visit<Corpse>(CorpseMapType&);
+
+void ObjectGridUnloadChecker::Visit(CreatureMapType& m)
+{
+    for (CreatureMapType::iterator iter = m.begin(); iter != m.end() && i_canUnload; ++iter)
+    {
+        Creature* creature = iter->GetSource();
+        CreatureData const* data = creature->GetCreatureData();
+
+        // dead creatures keep their respawn timer in memory only, summons and script spawns would not come back
+        if (!data || !creature->GetSpawnId() || creature->IsSummon() || !creature->IsAlive() || creature->IsInCombat() ||
+            creature->isActiveObject() || creature->GetTransport())
+        {
+            i_canUnload = false;
+            continue;
+        }
+
+        // a creature that wandered in from another grid is only reloaded with its home grid
+        GridCoord home = Acore::ComputeGridCoord(data->posX, data->posY);
+        if (home.x_coord != uint32(i_grid.getX()) || home.y_coord != uint32(i_grid.getY()))
+            i_canUnload = false;
+    }
+}
+
+void ObjectGridUnloadChecker::Visit(GameObjectMapType& m)
+{
+    for (GameObjectMapType::iterator iter = m.begin(); iter != m.end() && i_canUnload; ++iter)
+    {
+        GameObject* gameObject = iter->GetSource();
+        if (!gameObject->GetSpawnId() || gameObject->GetRespawnTime() || gameObject->GetOwnerGUID() ||
+            gameObject->isActiveObject() || gameObject->IsTransport())
+            i_canUnload = false;
+    }
+}
@@ -67,4 +67,21 @@ public:
     void Visit(CorpseMapType&) { }    // corpses are deleted with Map
     template<class T> void Visit(GridRefMgr<T>& m);
 };
+
+//Checks that a grid only holds idle database spawns, which come back unchanged when the grid is loaded again
+class ObjectGridUnloadChecker
+{
+public:
+    ObjectGridUnloadChecker(NGridType const& grid) : i_grid(grid), i_canUnload(true) {}
+
+    void Visit(CreatureMapType& m);
+    void Visit(GameObjectMapType& m);
+    template<class T> void Visit(GridRefMgr<T>& m) { i_canUnload = i_canUnload && m.IsEmpty(); }
+
+    [[nodiscard]] bool CanUnload() const { return i_canUnload; }
+
+private:
+    NGridType const& i_grid;
+    bool i_canUnload;
+};
 #endif
@@ -29,6 +29,7 @@
 #include "MapMgr.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
+#include "PacketBroadcast.h"
 #include "Pet.h"
 #include "Player.h"
 #include "ScriptMgr.h"
@@ -1724,6 +1725,7 @@ void Group::UpdatePlayerOutOfRange(Player* player)
 
 void Group::BroadcastPacket(WorldPacket const* packet, bool ignorePlayersInBGRaid, int group, ObjectGuid ignore)
 {
+    PacketBroadcast broadcast(packet, BROADCAST_SOURCE_GROUP);
     for (GroupReference* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
     {
         Player* player = itr->GetSource();
@@ -1731,7 +1733,7 @@ void Group::BroadcastPacket(WorldPacket const* packet, bool ignorePlayersInBGRai
             continue;
 
         if (group == -1 || itr->getSubGroup() == group)
-            player->GetSession()->SendPacket(packet);
+            broadcast.SendTo(player->GetSession());
     }
 }
 
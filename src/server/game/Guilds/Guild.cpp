@@ -31,6 +31,7 @@
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
+#include "PacketBroadcast.h"
 #include "Player.h"
 #include "ScriptMgr.h"
 #include "SocialMgr.h"
@@ -1734,6 +1735,7 @@ void Guild::HandleMemberLogout(WorldSession* session)
         member->UpdateLogoutTime();
         member->ResetFlags();
     }
+    m_onlineMembers.erase(player->GetGUID().GetCounter());
     _BroadcastEvent(GE_SIGNED_OFF, player->GetGUID(), player->GetName());
 }
 
@@ -1879,6 +1881,7 @@ void Guild::SendLoginInfo(WorldSession* session)
     {
         member->SetStats(player);
         member->AddFlag(GUILDMEMBER_STATUS_ONLINE);
+        m_onlineMembers.insert(player->GetGUID().GetCounter());
     }
 }
 
@@ -2103,26 +2106,32 @@ void Guild::BroadcastToGuild(WorldSession* session, bool officerOnly, std::strin
     {
         WorldPacket data;
         ChatHandler::BuildChatPacket(data, officerOnly ? CHAT_MSG_OFFICER : CHAT_MSG_GUILD, Language(language), session->GetPlayer(), nullptr, msg);
-        for (auto const& [guid, member] : m_members)
-            if (Player* player = member.FindPlayer())
+        PacketBroadcast broadcast(&data, BROADCAST_SOURCE_GUILD);
+        for (ObjectGuid::LowType lowGuid : m_onlineMembers)
+            if (Player* player = ObjectAccessor::FindConnectedPlayer(ObjectGuid::Create<HighGuid::Player>(lowGuid)))
                 if (_HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) && !player->GetSocial()->HasIgnore(session->GetPlayer()->GetGUID()))
-                    player->GetSession()->SendPacket(&data);
+                    broadcast.SendTo(player->GetSession());
     }
 }
 
 void Guild::BroadcastPacketToRank(WorldPacket const* packet, uint8 rankId) const
 {
-    for (auto const& [guid, member] : m_members)
-        if (member.IsRank(rankId))
-            if (Player* player = member.FindPlayer())
-                player->GetSession()->SendPacket(packet);
+    PacketBroadcast broadcast(packet, BROADCAST_SOURCE_GUILD);
+    for (ObjectGuid::LowType lowGuid : m_onlineMembers)
+    {
+        auto itr = m_members.find(lowGuid);
+        if (itr != m_members.end() && itr->second.IsRank(rankId))
+            if (Player* player = itr->second.FindPlayer())
+                broadcast.SendTo(player->GetSession());
+    }
 }
 
 void Guild::BroadcastPacket(WorldPacket const* packet) const
 {
-    for (auto const& [guid, member] : m_members)
-        if (Player* player = member.FindPlayer())
-            player->GetSession()->SendPacket(packet);
+    PacketBroadcast broadcast(packet, BROADCAST_SOURCE_GUILD);
+    for (ObjectGuid::LowType lowGuid : m_onlineMembers)
+        if (Player* player = ObjectAccessor::FindConnectedPlayer(ObjectGuid::Create<HighGuid::Player>(lowGuid)))
+            broadcast.SendTo(player->GetSession());
 }
 
 void Guild::MassInviteToEvent(WorldSession* session, uint32 minLevel, uint32 maxLevel, uint32 minRank)
@@ -2286,6 +2295,7 @@ void Guild::DeleteMember(ObjectGuid guid, bool isDisbanding, bool isKicked, bool
     sScriptMgr->OnGuildRemoveMember(this, player, isDisbanding, isKicked);
 
     m_members.erase(lowguid);
+    m_onlineMembers.erase(lowguid);
 
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
     if (player)
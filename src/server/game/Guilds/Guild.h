@@ -753,8 +753,8 @@ public:
     template<class Do>
     void BroadcastWorker(Do& _do, Player* except = nullptr)
     {
-        for (auto const& m_member : m_members)
-            if (Player* player = m_member.second.FindPlayer())
+        for (ObjectGuid::LowType lowGuid : m_onlineMembers)
+            if (Player* player = ObjectAccessor::FindConnectedPlayer(ObjectGuid::Create<HighGuid::Player>(lowGuid)))
                 if (player != except)
                     _do(player);
     }
@@ -796,6 +796,8 @@ protected:
 
     std::vector<RankInfo> m_ranks;
     std::unordered_map<uint32, Member> m_members;
+    // Members signed on through SendLoginInfo, broadcasts only walk these instead of the whole roster
+    std::unordered_set<ObjectGuid::LowType> m_onlineMembers;
     std::vector<BankTab> m_bankTabs;
 
     // These are actually ordered lists. The first element is the oldest entry.
@@ -36,11 +36,29 @@
 #include "Transport.h"
 #include "Vehicle.h"
 #include "WaypointMovementGenerator.h"
+#include "World.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
 
 #define MOVEMENT_PACKET_TIME_DELAY 0
 
+// Movement opcodes that only refresh the current movement state and can be superseded by a later packet of the same mover
+static bool IsCoalescableMovementOpcode(uint16 opcode)
+{
+    switch (opcode)
+    {
+        case MSG_MOVE_HEARTBEAT:
+        case MSG_MOVE_SET_FACING:
+        case MSG_MOVE_SET_PITCH:
+        case MSG_MOVE_START_TURN_LEFT:
+        case MSG_MOVE_START_TURN_RIGHT:
+        case MSG_MOVE_STOP_TURN:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void WorldSession::HandleMoveWorldportAckOpcode(WorldPacket& /*recvData*/)
 {
     LOG_DEBUG("network", "WORLD: got MSG_MOVE_WORLDPORT_ACK.");
@@ -285,6 +303,9 @@ void WorldSession::HandleMoveTeleportAck(WorldPacket& recvData)
 
     plMover->SetSemaphoreTeleportNear(0);
 
+    // do not let a movement packet queued before the teleport be broadcast after it
+    plMover->GetMap()->DropQueuedMovementBroadcast(plMover->GetGUID());
+
     uint32 old_zone = plMover->GetZoneId();
 
     WorldLocation const& dest = plMover->GetTeleportDest();
@@ -562,7 +583,20 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvData)
 
     movementInfo.guid = mover->GetGUID();
     WriteMovementInfo(&data, &movementInfo);
-    mover->SendMessageToSet(&data, _player);
+
+    if (sWorld->getBoolConfig(CONFIG_MOVEMENT_COALESCE_BROADCASTS))
+    {
+        if (IsCoalescableMovementOpcode(opcode))
+            mover->GetMap()->QueueMovementBroadcast(mover, std::move(data), _player);
+        else
+        {
+            // this packet carries a newer state than anything still queued for the mover
+            mover->GetMap()->DropQueuedMovementBroadcast(mover->GetGUID());
+            mover->SendMessageToSet(&data, _player);
+        }
+    }
+    else
+        mover->SendMessageToSet(&data, _player);
 
     mover->m_movementInfo = movementInfo;
 
@@ -785,6 +819,7 @@ void WorldSession::HandleMoveKnockBackAck(WorldPacket& recvData)
     ReadMovementInfo(recvData, &movementInfo);
 
     _player->m_mover->m_movementInfo = movementInfo;
+    _player->m_mover->GetMap()->DropQueuedMovementBroadcast(guid);
 
     WorldPacket data(MSG_MOVE_KNOCK_BACK, 66);
     data << guid.WriteAsPacked();
@@ -881,6 +916,9 @@ void WorldSession::HandleMoveTimeSkippedOpcode(WorldPacket& recvData)
 
     mover->m_movementInfo.time += timeSkipped;
 
+    // a heartbeat queued earlier in this tick would reach observers after the time skip
+    mover->GetMap()->DropQueuedMovementBroadcast(mover->GetGUID());
+
     WorldPacket data(MSG_MOVE_TIME_SKIPPED, recvData.size());
     data << guid.WriteAsPacked();
     data << timeSkipped;
@@ -991,6 +1029,7 @@ void WorldSession::HandleMoveRootAck(WorldPacket& recvData)
     movementInfo.guid = mover->GetGUID();
     mover->m_movementInfo = movementInfo;
     mover->UpdatePosition(movementInfo.pos);
+    mover->GetMap()->DropQueuedMovementBroadcast(mover->GetGUID());
 
     WorldPacket data(MSG_MOVE_ROOT, 64);
     WriteMovementInfo(&data, &movementInfo);
@@ -1036,6 +1075,7 @@ void WorldSession::HandleMoveUnRootAck(WorldPacket& recvData)
     movementInfo.guid = mover->GetGUID();
     mover->m_movementInfo = movementInfo;
     mover->UpdatePosition(movementInfo.pos);
+    mover->GetMap()->DropQueuedMovementBroadcast(mover->GetGUID());
 
     WorldPacket data(MSG_MOVE_UNROOT, 64);
     WriteMovementInfo(&data, &movementInfo);
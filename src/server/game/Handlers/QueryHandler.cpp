@@ -250,6 +250,7 @@ void WorldSession::HandleCorpseQueryOpcode(WorldPacket& /*recvData*/)
                     mapID = corpseMapEntry->entrance_map;
                     x = corpseMapEntry->entrance_x;
                     y = corpseMapEntry->entrance_y;
+                    std::lock_guard<std::recursive_mutex> guard(entranceMap->GetGridLock());
                     z = entranceMap->GetHeight(GetPlayer()->GetPhaseMask(), x, y, MAX_HEIGHT);
                 }
             }
@@ -35,6 +35,9 @@
 #include "World.h"
 
 uint16 InstanceSaveMgr::ResetTimeDelay[] = {3600, 900, 300, 60, 0};
+
+// instances wiped by a global reset are deleted from the DB in transactions of this many instances
+constexpr uint32 INSTANCE_RESET_DELETE_BATCH_SIZE = 100;
 PlayerBindStorage InstanceSaveMgr::playerBindStorage;
 BoundInstancesMap InstanceSaveMgr::emptyBoundInstancesMap;
 
@@ -247,13 +250,13 @@ void InstanceSaveMgr::SanitizeInstanceSavedData()
     CharacterDatabase.Execute(stmt);
 }
 
-void InstanceSaveMgr::DeleteInstanceSavedData(uint32 instanceId)
+void InstanceSaveMgr::DeleteInstanceSavedData(uint32 instanceId, CharacterDatabaseTransaction trans /*= nullptr*/)
 {
     if (instanceId)
     {
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DELETE_INSTANCE_SAVED_DATA);
         stmt->SetData(0, instanceId);
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.ExecuteOrAppend(trans, stmt);
     }
 }
 
@@ -420,8 +423,7 @@ void InstanceSaveMgr::LoadCharacterBinds()
 
             if (InstanceSave* save = GetInstanceSave(instanceId))
             {
-                PlayerCreateBoundInstancesMaps(guid);
-                InstancePlayerBind& bind = playerBindStorage[guid]->m[save->GetDifficulty()][save->GetMapId()];
+                InstancePlayerBind& bind = _GetOrCreateBoundInstancesMaps(guid)->m[save->GetDifficulty()][save->GetMapId()];
                 if (bind.save) // pussywizard: another bind for the same map and difficulty! may happen because of mysql thread races
                 {
                     if (bind.perm) // already loaded perm -> delete currently checked one from db
@@ -456,7 +458,7 @@ void InstanceSaveMgr::LoadCharacterBinds()
 
 void InstanceSaveMgr::ScheduleReset(time_t time, InstResetEvent event)
 {
-    m_resetTimeQueue.insert(std::pair<time_t, InstResetEvent>(time, event));
+    m_resetTimeQueue.push({ time, m_resetSequence++, event });
 }
 
 void InstanceSaveMgr::Update()
@@ -467,11 +469,12 @@ void InstanceSaveMgr::Update()
 
     while (!m_resetTimeQueue.empty())
     {
-        t = m_resetTimeQueue.begin()->first;
+        t = m_resetTimeQueue.top().resetTime;
         if (t >= now)
             break;
 
-        InstResetEvent& event = m_resetTimeQueue.begin()->second;
+        InstResetEvent event = m_resetTimeQueue.top().event;
+        m_resetTimeQueue.pop();
         if (event.type)
         {
             // global reset/warning for a certain map
@@ -487,7 +490,6 @@ void InstanceSaveMgr::Update()
             else
                 resetOccurred = true;
         }
-        m_resetTimeQueue.erase(m_resetTimeQueue.begin());
     }
 
     // pussywizard: send updated calendar and raid info
@@ -504,7 +506,7 @@ void InstanceSaveMgr::Update()
     }
 }
 
-void InstanceSaveMgr::_ResetSave(InstanceSaveHashMap::iterator& itr)
+void InstanceSaveMgr::_ResetSave(InstanceSaveHashMap::iterator& itr, CharacterDatabaseTransaction trans)
 {
     lock_instLists = true;
 
@@ -521,15 +523,15 @@ void InstanceSaveMgr::_ResetSave(InstanceSaveHashMap::iterator& itr)
         // delete character_instance per id, delete instance per id
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE);
         stmt->SetData(0, itr->second->GetInstanceId());
-        CharacterDatabase.Execute(stmt);
+        trans->Append(stmt);
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_INSTANCE_BY_INSTANCE);
         stmt->SetData(0, itr->second->GetInstanceId());
-        CharacterDatabase.Execute(stmt);
-        DeleteInstanceSavedData(itr->second->GetInstanceId());
+        trans->Append(stmt);
+        DeleteInstanceSavedData(itr->second->GetInstanceId(), trans);
 
         // clear respawn times if the map is already unloaded and won't do it by itself
         if (!sMapMgr->FindMap(itr->second->GetMapId(), itr->second->GetInstanceId()))
-            Map::DeleteRespawnTimesInDB(itr->second->GetMapId(), itr->second->GetInstanceId());
+            Map::DeleteRespawnTimesInDB(itr->second->GetMapId(), itr->second->GetInstanceId(), trans);
 
         sScriptMgr->OnInstanceIdRemoved(itr->second->GetInstanceId());
 
@@ -538,15 +540,13 @@ void InstanceSaveMgr::_ResetSave(InstanceSaveHashMap::iterator& itr)
     }
     else
     {
-        // delete character_instance per id where extended = 0, transtaction with set extended = 0, transaction is used to avoid mysql thread races
-        CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+        // delete character_instance per id where extended = 0, in the same transaction as set extended = 0 to avoid mysql thread races
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE_NOT_EXTENDED);
         stmt->SetData(0, itr->second->GetInstanceId());
         trans->Append(stmt);
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_CHAR_INSTANCE_SET_NOT_EXTENDED);
         stmt->SetData(0, itr->second->GetInstanceId());
         trans->Append(stmt);
-        CharacterDatabase.CommitTransaction(trans);
 
         // update reset time and extended reset time for instance save
         itr->second->SetResetTime(GetResetTimeFor(itr->second->GetMapId(), itr->second->GetDifficulty()));
@@ -595,12 +595,26 @@ void InstanceSaveMgr::_ResetOrWarnAll(uint32 mapid, Difficulty difficulty, bool
 
         // remove all binds to instances of the given map and delete from db (delete per instance id, no mass deletion!)
         // do this after new reset time is calculated
+        // the statements are batched so a reset of thousands of instances doesn't flood the DB queue with single statements
+        CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+        uint32 batched = 0;
         for (InstanceSaveHashMap::iterator itr = m_instanceSaveById.begin(), itr2; itr != m_instanceSaveById.end(); )
         {
             itr2 = itr++;
             if (itr2->second->GetMapId() == mapid && itr2->second->GetDifficulty() == difficulty)
-                _ResetSave(itr2);
+            {
+                _ResetSave(itr2, trans);
+                if (++batched == INSTANCE_RESET_DELETE_BATCH_SIZE)
+                {
+                    CharacterDatabase.CommitTransaction(trans);
+                    trans = CharacterDatabase.BeginTransaction();
+                    batched = 0;
+                }
+            }
         }
+
+        if (batched)
+            CharacterDatabase.CommitTransaction(trans);
     }
 
     // now loop all existing maps to warn / reset
@@ -634,7 +648,7 @@ void InstanceSaveMgr::_ResetOrWarnAll(uint32 mapid, Difficulty difficulty, bool
 
 InstancePlayerBind* InstanceSaveMgr::PlayerBindToInstance(ObjectGuid guid, InstanceSave* save, bool permanent, Player* player /*= nullptr*/)
 {
-    InstancePlayerBind& bind = playerBindStorage[guid]->m[save->GetDifficulty()][save->GetMapId()];
+    InstancePlayerBind& bind = _GetOrCreateBoundInstancesMaps(guid)->m[save->GetDifficulty()][save->GetMapId()];
     ASSERT(!bind.perm || permanent); // ensure there's no changing permanent to temporary, this can be done only by unbinding
 
     if (bind.save)
@@ -703,7 +717,11 @@ InstancePlayerBind* InstanceSaveMgr::PlayerBindToInstance(ObjectGuid guid, Insta
 
 void InstanceSaveMgr::PlayerUnbindInstance(ObjectGuid guid, uint32 mapid, Difficulty difficulty, bool deleteFromDB, Player* player /*= nullptr*/)
 {
-    BoundInstancesMapWrapper* w = playerBindStorage[guid];
+    PlayerBindStorage::const_iterator storage = playerBindStorage.find(guid);
+    if (storage == playerBindStorage.end())
+        return;
+
+    BoundInstancesMapWrapper* w = storage->second;
     BoundInstancesMap::iterator itr = w->m[difficulty].find(mapid);
     if (itr != w->m[difficulty].end())
     {
@@ -726,7 +744,11 @@ void InstanceSaveMgr::PlayerUnbindInstance(ObjectGuid guid, uint32 mapid, Diffic
 
 void InstanceSaveMgr::PlayerUnbindInstanceNotExtended(ObjectGuid guid, uint32 mapid, Difficulty difficulty, Player* player /*= nullptr*/)
 {
-    BoundInstancesMapWrapper* w = playerBindStorage[guid];
+    PlayerBindStorage::const_iterator storage = playerBindStorage.find(guid);
+    if (storage == playerBindStorage.end())
+        return;
+
+    BoundInstancesMapWrapper* w = storage->second;
     BoundInstancesMap::iterator itr = w->m[difficulty].find(mapid);
     if (itr != w->m[difficulty].end())
     {
@@ -784,8 +806,30 @@ BoundInstancesMap const& InstanceSaveMgr::PlayerGetBoundInstances(ObjectGuid gui
 
 void InstanceSaveMgr::PlayerCreateBoundInstancesMaps(ObjectGuid guid)
 {
-    if (playerBindStorage.find(guid) == playerBindStorage.end())
-        playerBindStorage[guid] = new BoundInstancesMapWrapper;
+    _GetOrCreateBoundInstancesMaps(guid);
+}
+
+BoundInstancesMapWrapper* InstanceSaveMgr::_GetOrCreateBoundInstancesMaps(ObjectGuid guid)
+{
+    BoundInstancesMapWrapper*& w = playerBindStorage[guid];
+    if (!w)
+        w = new BoundInstancesMapWrapper;
+    return w;
+}
+
+void InstanceSaveMgr::PlayerUnloadBoundInstancesMaps(ObjectGuid guid)
+{
+    // binds keep their instance saves alive (InstanceSave::m_playerList), so only containers without binds can go
+    PlayerBindStorage::iterator itr = playerBindStorage.find(guid);
+    if (itr == playerBindStorage.end())
+        return;
+
+    for (uint8 d = 0; d < MAX_DIFFICULTY; ++d)
+        if (!itr->second->m[d].empty())
+            return;
+
+    delete itr->second;
+    playerBindStorage.erase(itr);
 }
 
 InstanceSave* InstanceSaveMgr::PlayerGetInstanceSave(ObjectGuid guid, uint32 mapid, Difficulty difficulty)
@@ -24,9 +24,10 @@
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
 #include <list>
-#include <map>
 #include <mutex>
+#include <queue>
 #include <unordered_map>
+#include <vector>
 
 struct InstanceTemplate;
 struct MapEntry;
@@ -126,7 +127,24 @@ public:
         InstResetEvent(uint8 t, uint32 _mapid, Difficulty d)
             : type(t), difficulty(d), mapid(_mapid) {}
     };
-    typedef std::multimap<time_t /*resetTime*/, InstResetEvent> ResetTimeQueue;
+    struct ScheduledResetEvent
+    {
+        time_t resetTime;
+        uint64 sequence;
+        InstResetEvent event;
+    };
+
+    // events due at the same time run in the order they were scheduled
+    struct ScheduledResetEventLater
+    {
+        bool operator()(ScheduledResetEvent const& left, ScheduledResetEvent const& right) const
+        {
+            return left.resetTime != right.resetTime ? left.resetTime > right.resetTime : left.sequence > right.sequence;
+        }
+    };
+
+    // min-heap on the event time, the earliest event is always on top
+    typedef std::priority_queue<ScheduledResetEvent, std::vector<ScheduledResetEvent>, ScheduledResetEventLater> ResetTimeQueue;
 
     void LoadInstances();
     void LoadResetTimes();
@@ -177,13 +195,15 @@ public:
     bool PlayerIsPermBoundToInstance(ObjectGuid guid, uint32 mapid, Difficulty difficulty);
     BoundInstancesMap const& PlayerGetBoundInstances(ObjectGuid guid, Difficulty difficulty);
     void PlayerCreateBoundInstancesMaps(ObjectGuid guid);
+    // Drops the bind containers of a logging out player that has no binds, they are recreated on demand
+    void PlayerUnloadBoundInstancesMaps(ObjectGuid guid);
     InstanceSave* PlayerGetInstanceSave(ObjectGuid guid, uint32 mapid, Difficulty difficulty);
     uint32 PlayerGetDestinationInstanceId(Player* player, uint32 mapid, Difficulty difficulty);
     void CopyBinds(ObjectGuid from, ObjectGuid to, Player* toPlr = nullptr);
     void UnbindAllFor(InstanceSave* save);
 
     void SanitizeInstanceSavedData();
-    void DeleteInstanceSavedData(uint32 instanceId);
+    void DeleteInstanceSavedData(uint32 instanceId, CharacterDatabaseTransaction trans = nullptr);
 protected:
     static uint16 ResetTimeDelay[];
     static PlayerBindStorage playerBindStorage;
@@ -191,12 +211,14 @@ protected:
 
 private:
     void _ResetOrWarnAll(uint32 mapid, Difficulty difficulty, bool warn, time_t resetTime);
-    void _ResetSave(InstanceSaveHashMap::iterator& itr);
+    void _ResetSave(InstanceSaveHashMap::iterator& itr, CharacterDatabaseTransaction trans);
+    BoundInstancesMapWrapper* _GetOrCreateBoundInstancesMaps(ObjectGuid guid);
     bool lock_instLists{false};
     InstanceSaveHashMap m_instanceSaveById;
     ResetTimeByMapDifficultyMap m_resetTimeByMapDifficulty;
     ResetTimeByMapDifficultyMap m_resetExtendedTimeByMapDifficulty;
     ResetTimeQueue m_resetTimeQueue;
+    uint64 m_resetSequence{0};
 };
 
 #define sInstanceSaveMgr InstanceSaveMgr::instance()
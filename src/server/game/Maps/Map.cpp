@@ -21,6 +21,8 @@
 #include "Chat.h"
 #include "DisableMgr.h"
 #include "DynamicTree.h"
+#include "GameEventMgr.h"
+#include "GameObjectAI.h"
 #include "GameTime.h"
 #include "Geometry.h"
 #include "GridNotifiers.h"
@@ -251,6 +253,8 @@ Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
         }
     }
 
+    _idleGridsCheckTimer.SetInterval(10 * IN_MILLISECONDS);
+
     //lets initialize visibility distance for map
     Map::InitVisibilityDistance();
 
@@ -435,7 +439,7 @@ void Map::EnsureGridCreated(const GridCoord& p)
 {
     if (getNGrid(p.x_coord, p.y_coord)) // pussywizard
         return;
-    std::lock_guard<std::mutex> guard(GridLock);
+    std::lock_guard<std::recursive_mutex> guard(GridLock);
     EnsureGridCreated_i(p);
 }
 
@@ -756,6 +760,8 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         }
     }
 
+    SendQueuedMovementBroadcasts();
+
     if (!t_diff)
     {
         for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
@@ -773,6 +779,8 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         return;
     }
 
+    SpawnQueuedObjects();
+
     /// update active cells around players and active objects
     resetMarkedCells();
     resetMarkedCellsLarge();
@@ -879,6 +887,8 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 
     HandleDelayedVisibility();
 
+    UnloadIdleGrids(t_diff);
+
     sScriptMgr->OnMapUpdate(this, t_diff);
 
     METRIC_VALUE("map_creatures", uint64(GetObjectsStore().Size<Creature>()),
@@ -1214,6 +1224,7 @@ void Map::MoveAllDynamicObjectsInMoveList()
 bool Map::UnloadGrid(NGridType& ngrid)
 {
     // pussywizard: UnloadGrid only done when whole map is unloaded, no need to worry about moving npcs between grids, etc.
+    // idle continent grids are unloaded as well, but only after ObjectGridUnloadChecker made sure nothing in them can move or act
 
     const uint32 x = ngrid.getX();
     const uint32 y = ngrid.getY();
@@ -1234,6 +1245,9 @@ bool Map::UnloadGrid(NGridType& ngrid)
 
     ASSERT(i_objectsToRemove.empty());
 
+    // terrain lookups from other threads (sMapMgr->GetZoneId and friends) hold GridLock while reading GridMaps and vmap/mmap tiles
+    std::lock_guard<std::recursive_mutex> guard(GridLock);
+
     delete &ngrid;
     setNGrid(nullptr, x, y);
 
@@ -1258,6 +1272,103 @@ bool Map::UnloadGrid(NGridType& ngrid)
     return true;
 }
 
+void Map::UnloadIdleGrids(uint32 diff)
+{
+    // instances share terrain with their parent map and are unloaded as a whole anyway
+    if (Instanceable())
+        return;
+
+    uint32 const idleTime = sWorld->getIntConfig(CONFIG_GRID_UNLOAD_IDLE_TIME) * IN_MILLISECONDS;
+    uint32 const maxGrids = sWorld->getIntConfig(CONFIG_GRID_UNLOAD_MAX_GRIDS);
+    if (!idleTime && !maxGrids)
+        return;
+
+    _idleGridsCheckTimer.Update(diff);
+    if (!_idleGridsCheckTimer.Passed())
+        return;
+
+    uint32 const elapsed = _idleGridsCheckTimer.GetCurrent();
+    _idleGridsCheckTimer.SetCurrent(0);
+
+    // everything a player, its viewpoint, an active object or a transport may see soon stays loaded,
+    // the extra grid of margin keeps grids at the edge of visibility from being loaded and unloaded over and over
+    std::bitset<MAX_NUMBER_OF_GRIDS * MAX_NUMBER_OF_GRIDS> keptGrids;
+    int32 const keepRadius = int32(std::ceil(GetVisibilityRange() / SIZE_OF_GRIDS)) + 1;
+    auto keepGridsAround = [&keptGrids, keepRadius](WorldObject const* obj)
+    {
+        GridCoord center = Acore::ComputeGridCoord(obj->GetPositionX(), obj->GetPositionY());
+        if (!center.IsCoordValid())
+            return;
+
+        for (int32 x = std::max<int32>(0, int32(center.x_coord) - keepRadius); x <= std::min<int32>(MAX_NUMBER_OF_GRIDS - 1, int32(center.x_coord) + keepRadius); ++x)
+            for (int32 y = std::max<int32>(0, int32(center.y_coord) - keepRadius); y <= std::min<int32>(MAX_NUMBER_OF_GRIDS - 1, int32(center.y_coord) + keepRadius); ++y)
+                keptGrids.set(x * MAX_NUMBER_OF_GRIDS + y);
+    };
+
+    for (MapRefMgr::iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
+    {
+        Player* player = itr->GetSource();
+        keepGridsAround(player);
+        if (WorldObject* viewPoint = player->GetViewpoint())
+            keepGridsAround(viewPoint);
+    }
+
+    for (WorldObject* obj : m_activeNonPlayers)
+        keepGridsAround(obj);
+
+    for (Transport* transport : _transports)
+        keepGridsAround(transport);
+
+    std::vector<NGridType*> idleGrids;
+    uint32 loadedGrids = 0;
+    for (GridRefMgr<NGridType>::iterator i = GridRefMgr<NGridType>::begin(); i != GridRefMgr<NGridType>::end(); ++i)
+    {
+        NGridType* grid = i->GetSource();
+        ++loadedGrids;
+
+        bool canUnload = !keptGrids.test(grid->getX() * MAX_NUMBER_OF_GRIDS + grid->getY());
+        if (canUnload)
+        {
+            ObjectGridUnloadChecker worker(*grid);
+            TypeContainerVisitor<ObjectGridUnloadChecker, GridTypeMapContainer> gridVisitor(worker);
+            TypeContainerVisitor<ObjectGridUnloadChecker, WorldTypeMapContainer> worldVisitor(worker);
+            grid->VisitAllGrids(gridVisitor);
+            grid->VisitAllGrids(worldVisitor);
+            canUnload = worker.CanUnload();
+        }
+
+        if (!canUnload)
+        {
+            grid->SetIdleTime(0);
+            continue;
+        }
+
+        grid->SetIdleTime(grid->GetIdleTime() + elapsed);
+        idleGrids.push_back(grid);
+    }
+
+    std::sort(idleGrids.begin(), idleGrids.end(), [](NGridType const* left, NGridType const* right) { return left->GetIdleTime() > right->GetIdleTime(); });
+
+    uint32 unloadedGrids = 0;
+    for (NGridType* grid : idleGrids)
+    {
+        // over budget any grid idle for a whole check interval may go, otherwise only the ones idle long enough
+        bool const overBudget = maxGrids && loadedGrids - unloadedGrids > maxGrids;
+        if (!overBudget && (!idleTime || grid->GetIdleTime() < idleTime))
+            break;
+
+        UnloadGrid(*grid);
+        ++unloadedGrids;
+    }
+
+    if (unloadedGrids)
+        LOG_DEBUG("maps", "Unloaded {} idle grids of {} for map {}", unloadedGrids, loadedGrids, GetId());
+
+    METRIC_VALUE("map_loaded_grids", uint64(loadedGrids - unloadedGrids),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+}
+
 void Map::RemoveAllPlayers()
 {
     if (HavePlayers())
@@ -2627,6 +2738,122 @@ void Map::SendObjectUpdates()
     }
 }
 
+void Map::QueueMovementBroadcast(Unit const* mover, WorldPacket&& data, Player const* skipped_rcvr)
+{
+    QueuedMovementBroadcast& queued = _queuedMovementBroadcasts[mover->GetGUID()];
+    queued.Packet = std::move(data);
+    queued.SkippedReceiver = skipped_rcvr ? skipped_rcvr->GetGUID() : ObjectGuid::Empty;
+}
+
+void Map::QueueCreatureSpawn(ObjectGuid::LowType spawnId, uint16 startedEventId)
+{
+    std::lock_guard<std::mutex> guard(_queuedSpawnsLock);
+    _queuedCreatureSpawns.push_back({ spawnId, startedEventId });
+}
+
+void Map::QueueGameObjectSpawn(ObjectGuid::LowType spawnId, uint16 startedEventId)
+{
+    std::lock_guard<std::mutex> guard(_queuedSpawnsLock);
+    _queuedGameObjectSpawns.push_back({ spawnId, startedEventId });
+}
+
+void Map::SpawnQueuedObjects()
+{
+    std::vector<QueuedSpawn> creatures;
+    std::vector<QueuedSpawn> gameobjects;
+    {
+        std::lock_guard<std::mutex> guard(_queuedSpawnsLock);
+        if (_queuedCreatureSpawns.empty() && _queuedGameObjectSpawns.empty())
+            return;
+
+        uint32 budget = std::max<uint32>(1, sWorld->getIntConfig(CONFIG_GAME_EVENT_SPAWNS_PER_MAP_UPDATE));
+        while (budget && !_queuedCreatureSpawns.empty())
+        {
+            creatures.push_back(_queuedCreatureSpawns.front());
+            _queuedCreatureSpawns.pop_front();
+            --budget;
+        }
+
+        while (budget && !_queuedGameObjectSpawns.empty())
+        {
+            gameobjects.push_back(_queuedGameObjectSpawns.front());
+            _queuedGameObjectSpawns.pop_front();
+            --budget;
+        }
+    }
+
+    // the event may have ended, or the grid may have been unloaded and reloaded (which spawns the object itself), since queueing
+    // spawning without the queue runs SMART_EVENT_GAME_EVENT_START on these objects right after creating them, do the same here
+    for (QueuedSpawn const& queued : creatures)
+    {
+        CreatureData const* data = sObjectMgr->GetCreatureData(queued.SpawnId);
+        if (!data || !IsGridLoaded(data->posX, data->posY) || _creatureBySpawnIdStore.count(queued.SpawnId))
+            continue;
+
+        if (!sObjectMgr->GetCellObjectGuids(GetId(), GetSpawnMode(), Acore::ComputeCellCoord(data->posX, data->posY).GetId()).creatures.count(queued.SpawnId))
+            continue;
+
+        Creature* creature = new Creature;
+        if (!creature->LoadCreatureFromDB(queued.SpawnId, this))
+        {
+            delete creature;
+            continue;
+        }
+
+        if (queued.StartedEventId && sGameEventMgr->IsActiveEvent(queued.StartedEventId) && creature->IsInWorld() && creature->IsAIEnabled && creature->AI())
+            creature->AI()->sOnGameEvent(true, queued.StartedEventId);
+    }
+
+    for (QueuedSpawn const& queued : gameobjects)
+    {
+        GameObjectData const* data = sObjectMgr->GetGameObjectData(queued.SpawnId);
+        if (!data || !IsGridLoaded(data->posX, data->posY) || _gameobjectBySpawnIdStore.count(queued.SpawnId))
+            continue;
+
+        if (!sObjectMgr->GetCellObjectGuids(GetId(), GetSpawnMode(), Acore::ComputeCellCoord(data->posX, data->posY).GetId()).gameobjects.count(queued.SpawnId))
+            continue;
+
+        GameObject* gameobject = sObjectMgr->IsGameObjectStaticTransport(data->id) ? new StaticTransport() : new GameObject();
+        if (!gameobject->LoadGameObjectFromDB(queued.SpawnId, this, false))
+        {
+            delete gameobject;
+            continue;
+        }
+
+        if (gameobject->isSpawnedByDefault())
+            AddToMap(gameobject);
+
+        if (queued.StartedEventId && sGameEventMgr->IsActiveEvent(queued.StartedEventId) && gameobject->IsInWorld() && gameobject->AI())
+            gameobject->AI()->OnGameEvent(true, queued.StartedEventId);
+    }
+}
+
+void Map::SendQueuedMovementBroadcasts()
+{
+    if (_queuedMovementBroadcasts.empty())
+        return;
+
+    for (auto const& [moverGuid, queued] : _queuedMovementBroadcasts)
+    {
+        Unit* mover = nullptr;
+        if (moverGuid.IsPlayer())
+            mover = ObjectAccessor::GetPlayer(this, moverGuid);
+        else if (moverGuid.IsPet())
+            mover = GetPet(moverGuid);
+        else
+            mover = GetCreature(moverGuid);
+
+        // mover left the map or is being removed since the packet was queued
+        if (!mover || !mover->IsInWorld() || mover->IsDuringRemoveFromWorld())
+            continue;
+
+        Player const* skipped = queued.SkippedReceiver ? ObjectAccessor::GetPlayer(this, queued.SkippedReceiver) : nullptr;
+        mover->SendMessageToSet(&queued.Packet, skipped);
+    }
+
+    _queuedMovementBroadcasts.clear();
+}
+
 void Map::DelayedUpdate(const uint32 t_diff)
 {
     for (_transportsUpdateIter = _transports.begin(); _transportsUpdateIter != _transports.end();)
@@ -2748,8 +2975,9 @@ uint32 Map::GetPlayersCountExceptGMs() const
 
 void Map::SendToPlayers(WorldPacket const* data) const
 {
+    LazySharedWorldPacket sharedData(data);
     for (MapRefMgr::const_iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
-        itr->GetSource()->GetSession()->SendPacket(data);
+        itr->GetSource()->GetSession()->SendPacket(sharedData.Get());
 }
 
 template<class T>
@@ -3445,17 +3673,17 @@ void Map::DeleteRespawnTimes()
     DeleteRespawnTimesInDB(GetId(), GetInstanceId());
 }
 
-void Map::DeleteRespawnTimesInDB(uint16 mapId, uint32 instanceId)
+void Map::DeleteRespawnTimesInDB(uint16 mapId, uint32 instanceId, CharacterDatabaseTransaction trans /*= nullptr*/)
 {
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN_BY_INSTANCE);
     stmt->SetData(0, mapId);
     stmt->SetData(1, instanceId);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.ExecuteOrAppend(trans, stmt);
 
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GO_RESPAWN_BY_INSTANCE);
     stmt->SetData(0, mapId);
     stmt->SetData(1, instanceId);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.ExecuteOrAppend(trans, stmt);
 }
 
 void Map::UpdateEncounterState(EncounterCreditType type, uint32 creditEntry, Unit* source)
@@ -21,6 +21,7 @@
 #include "Cell.h"
 #include "DBCStructure.h"
 #include "DataMap.h"
+#include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "DynamicTree.h"
 #include "GameObjectModel.h"
@@ -33,7 +34,9 @@
 #include "Position.h"
 #include "SharedDefines.h"
 #include "Timer.h"
+#include "WorldPacket.h"
 #include <bitset>
+#include <deque>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -384,6 +387,8 @@ public:
 
     // pussywizard: movemaps, mmaps
     [[nodiscard]] std::shared_mutex& GetMMapLock() const { return *(const_cast<std::shared_mutex*>(&MMapLock)); }
+    // idle continent grids and their terrain are freed by the map thread, other threads must hold this while reading terrain
+    [[nodiscard]] std::recursive_mutex& GetGridLock() const { return *(const_cast<std::recursive_mutex*>(&GridLock)); }
     // pussywizard:
     std::unordered_set<Unit*> i_objectsForDelayedVisibility;
     void HandleDelayedVisibility();
@@ -601,7 +606,7 @@ public:
     Corpse* ConvertCorpseToBones(ObjectGuid const ownerGuid, bool insignia = false);
     void RemoveOldCorpses();
 
-    static void DeleteRespawnTimesInDB(uint16 mapId, uint32 instanceId);
+    static void DeleteRespawnTimesInDB(uint16 mapId, uint32 instanceId, CharacterDatabaseTransaction trans = nullptr);
 
     void SendInitTransports(Player* player);
     void SendRemoveTransports(Player* player);
@@ -650,6 +655,17 @@ public:
         return m_activeNonPlayers.size();
     }
 
+    // Movement broadcast coalescing (Movement.CoalesceBroadcasts): only the latest queued packet per mover is sent,
+    // once per map update, after all sessions on this map have been processed
+    void QueueMovementBroadcast(Unit const* mover, WorldPacket&& data, Player const* skipped_rcvr);
+    void DropQueuedMovementBroadcast(ObjectGuid const& moverGuid) { _queuedMovementBroadcasts.erase(moverGuid); }
+
+    // Spawns into loaded grids requested by game event transitions (GameEvent.SpawnsPerMapUpdate),
+    // created by this map's own update in batches. May be called from any thread.
+    // Objects spawned for a started event get its AI game event hook once created, if the event is still active.
+    void QueueCreatureSpawn(ObjectGuid::LowType spawnId, uint16 startedEventId);
+    void QueueGameObjectSpawn(ObjectGuid::LowType spawnId, uint16 startedEventId);
+
     virtual std::string GetDebugInfo() const;
 
 private:
@@ -693,10 +709,12 @@ private:
     void UpdateActiveCells(const float& x, const float& y, const uint32 t_diff);
 
     void SendObjectUpdates();
+    void SendQueuedMovementBroadcasts();
+    void SpawnQueuedObjects();
 
 protected:
     std::mutex Lock;
-    std::mutex GridLock;
+    std::recursive_mutex GridLock;
     std::shared_mutex MMapLock;
 
     MapEntry const* i_mapEntry;
@@ -737,6 +755,10 @@ private:
     std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP* TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
     std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP* TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells_large;
 
+    // continent grids out of reach of players and active objects are unloaded, see GridUnload.* config
+    void UnloadIdleGrids(uint32 diff);
+    IntervalTimer _idleGridsCheckTimer;
+
     bool i_scriptLock;
     std::unordered_set<WorldObject*> i_objectsToRemove;
     std::map<WorldObject*, bool> i_objectsToSwitch;
@@ -798,6 +820,24 @@ private:
     std::unordered_set<Corpse*> _corpseBones;
 
     std::unordered_set<Object*> _updateObjects;
+
+    struct QueuedMovementBroadcast
+    {
+        WorldPacket Packet;
+        ObjectGuid SkippedReceiver;
+    };
+
+    std::unordered_map<ObjectGuid, QueuedMovementBroadcast> _queuedMovementBroadcasts;
+
+    struct QueuedSpawn
+    {
+        ObjectGuid::LowType SpawnId;
+        uint16 StartedEventId;                              // 0 when spawned by an event stop
+    };
+
+    std::deque<QueuedSpawn> _queuedCreatureSpawns;
+    std::deque<QueuedSpawn> _queuedGameObjectSpawns;
+    std::mutex _queuedSpawnsLock;
 };
 
 enum InstanceResetMethod
@@ -51,6 +51,7 @@ public:
     [[nodiscard]] uint32 GetAreaId(uint32 phaseMask, uint32 mapid, float x, float y, float z) const
     {
         Map const* m = const_cast<MapMgr*>(this)->CreateBaseMap(mapid);
+        std::lock_guard<std::recursive_mutex> guard(m->GetGridLock());
         return m->GetAreaId(phaseMask, x, y, z);
     }
     [[nodiscard]] uint32 GetAreaId(uint32 phaseMask, uint32 mapid, Position const& pos) const { return GetAreaId(phaseMask, mapid, pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ()); }
@@ -59,6 +60,7 @@ public:
     [[nodiscard]] uint32 GetZoneId(uint32 phaseMask, uint32 mapid, float x, float y, float z) const
     {
         Map const* m = const_cast<MapMgr*>(this)->CreateBaseMap(mapid);
+        std::lock_guard<std::recursive_mutex> guard(m->GetGridLock());
         return m->GetZoneId(phaseMask, x, y, z);
     }
     [[nodiscard]] uint32 GetZoneId(uint32 phaseMask, uint32 mapid, Position const& pos) const { return GetZoneId(phaseMask, mapid, pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ()); }
@@ -67,6 +69,7 @@ public:
     void GetZoneAndAreaId(uint32 phaseMask, uint32& zoneid, uint32& areaid, uint32 mapid, float x, float y, float z)
     {
         Map const* m = const_cast<MapMgr*>(this)->CreateBaseMap(mapid);
+        std::lock_guard<std::recursive_mutex> guard(m->GetGridLock());
         m->GetZoneAndAreaId(phaseMask, zoneid, areaid, x, y, z);
     }
 
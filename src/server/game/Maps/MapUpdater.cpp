@@ -20,6 +20,7 @@
 #include "Map.h"
 #include "MapUpdater.h"
 #include "Metric.h"
+#include "ObjectPool.h"
 
 class UpdateRequest
 {
@@ -27,6 +28,9 @@ public:
     UpdateRequest() = default;
     virtual ~UpdateRequest() = default;
 
+    // scheduled by the world thread every tick and freed by the map threads
+    OBJECT_POOL_ALLOCATED("UpdateRequest")
+
     virtual void call() = 0;
 };
 
@@ -17,15 +17,21 @@
 
 #include "AsyncAuctionListing.h"
 #include "Creature.h"
+#include "DBCStores.h"
+#include "GameEventMgr.h"
 #include "ObjectAccessor.h"
 #include "Opcodes.h"
 #include "Player.h"
+#include "PlayerItemUsability.h"
 #include "SpellAuraEffects.h"
 
-Milliseconds AsyncAuctionListingMgr::auctionListingDiff = Milliseconds::zero();
 std::list<AuctionListItemsDelayEvent> AsyncAuctionListingMgr::auctionListingList;
 std::list<AuctionListItemsDelayEvent> AsyncAuctionListingMgr::auctionListingListTemp;
 std::mutex AsyncAuctionListingMgr::auctionListingTempLock;
+std::list<AuctionListItemsDelayEvent> AsyncAuctionListingMgr::auctionSearchQueue;
+std::list<AuctionListItemsDelayEvent> AsyncAuctionListingMgr::auctionSearchResults;
+std::mutex AsyncAuctionListingMgr::auctionSearchLock;
+std::condition_variable AsyncAuctionListingMgr::auctionSearchCondition;
 
 bool AuctionListOwnerItemsDelayEvent::Execute(uint64  /*e_time*/, uint32  /*p_time*/)
 {
@@ -34,43 +40,174 @@ bool AuctionListOwnerItemsDelayEvent::Execute(uint64  /*e_time*/, uint32  /*p_ti
     return true;
 }
 
-bool AuctionListItemsDelayEvent::Execute()
+AuctionUsableFilter::AuctionUsableFilter(Player const* player) :
+    _alive(player->IsAlive()), _team(player->GetTeamId(true)), _class(player->getClass()),
+    _classMask(player->getClassMask()), _raceMask(player->getRaceMask()), _level(player->GetLevel())
+{
+    for (SkillLineEntry const* skillLine : sSkillLineStore)
+        if (player->HasSkill(skillLine->id))
+            _skills[skillLine->id] = player->GetSkillValue(skillLine->id);
+
+    for (FactionEntry const* faction : sFactionStore)
+        _reputationRanks[faction->ID] = player->GetReputationRank(faction->ID);
+
+    for (auto const& [spellId, spell] : player->GetSpellMap())
+        if (spell->State != PLAYERSPELL_REMOVED && spell->IsInSpec(player->GetActiveSpec()))
+            _spells.insert(spellId);
+
+    GameEventMgr::GameEventDataMap const& events = sGameEventMgr->GetEventMap();
+    for (uint16 eventId : sGameEventMgr->GetActiveEventList())
+        if (events[eventId].holiday_id != HOLIDAY_NONE)
+            _holidays.insert(events[eventId].holiday_id);
+}
+
+uint16 AuctionUsableFilter::GetSkillValue(uint32 skill) const
+{
+    auto itr = _skills.find(skill);
+    return itr != _skills.end() ? itr->second : 0;
+}
+
+ReputationRank AuctionUsableFilter::GetReputationRank(uint32 faction) const
+{
+    // like Player::GetReputationRank for a faction id missing from Faction.dbc
+    auto itr = _reputationRanks.find(faction);
+    return itr != _reputationRanks.end() ? itr->second : REP_NEUTRAL;
+}
+
+bool AuctionUsableFilter::CanUse(ItemTemplate const* proto) const
+{
+    if (!_alive)
+        return false;
+
+    if (Acore::CanUseItemTemplate(*this, proto) != EQUIP_ERR_OK || Acore::CanUseItemProficiency(*this, proto) != EQUIP_ERR_OK)
+        return false;
+
+    // xinef: check already learded recipes and pets
+    if (proto->Spells[1].SpellTrigger == ITEM_SPELLTRIGGER_LEARN_SPELL_ID && HasSpell(proto->Spells[1].SpellId))
+        return false;
+
+    return true;
+}
+
+bool AuctionListItemsDelayEvent::Prepare()
 {
     Player* plr = ObjectAccessor::FindPlayer(_playerguid);
     if (!plr || !plr->IsInWorld() || plr->IsDuringRemoveFromWorld() || plr->IsBeingTeleported())
-        return true;
+        return false;
 
     Creature* creature = plr->GetNPCIfCanInteractWith(_creatureguid, UNIT_NPC_FLAG_AUCTIONEER);
     if (!creature)
-        return true;
+        return false;
 
-    AuctionHouseObject* auctionHouse = sAuctionMgr->GetAuctionsMap(creature->GetFaction());
+    _auctionHouse = sAuctionMgr->GetAuctionsMap(creature->GetFaction());
+    _snapshot = _auctionHouse->GetListingSnapshot();
+    _locale = plr->GetSession()->GetSessionDbLocaleIndex();
+    _dbcLocale = plr->GetSession()->GetSessionDbcLocale();
+    _searchTimeout = Milliseconds(sWorld->getIntConfig(CONFIG_AUCTION_HOUSE_SEARCH_TIMEOUT));
+    if (_usable)
+        _usableFilter.emplace(plr);
 
-    WorldPacket data(SMSG_AUCTION_LIST_RESULT, (4 + 4 + 4) + 50 * ((16 + MAX_INSPECTED_ENCHANTMENT_SLOT * 3) * 4));
-    uint32 count = 0;
-    uint32 totalcount = 0;
-    data << (uint32) 0;
+    return true;
+}
 
+void AuctionListItemsDelayEvent::Execute()
+{
     // converting string that we try to find to lower case
     std::wstring wsearchedname;
     if (!Utf8toWStr(_searchedname, wsearchedname))
-        return true;
+        return;
 
     wstrToLower(wsearchedname);
 
-    uint32 searchTimeout = sWorld->getIntConfig(CONFIG_AUCTION_HOUSE_SEARCH_TIMEOUT);
-    bool result = auctionHouse->BuildListAuctionItems(data, plr,
-                  wsearchedname, _listfrom, _levelmin, _levelmax, _usable,
-                  _auctionSlotID, _auctionMainCategory, _auctionSubCategory, _quality,
-                  count, totalcount, _getAll, _sortOrder, Milliseconds(searchTimeout));
+    // usable searches need the whole list in order, the filter decides which auctions count for the page
+    _found = _auctionHouse->BuildListAuctionItems(*_snapshot, _shortlist,
+             wsearchedname, _listfrom, _levelmin, _levelmax,
+             _auctionSlotID, _auctionMainCategory, _auctionSubCategory, _quality,
+             _locale, _dbcLocale, _usable != 0, _sortOrder, _searchTimeout);
+
+    if (_found)
+        BuildResult();
+}
 
-    if (result)
+void AuctionListItemsDelayEvent::Complete()
+{
+    if (!_found)
+        return;
+
+    Player* plr = ObjectAccessor::FindPlayer(_playerguid);
+    if (!plr || !plr->IsInWorld())
+        return;
+
+    plr->GetSession()->SendPacket(&_result);
+}
+
+void AuctionListItemsDelayEvent::BuildResult()
+{
+    _result.Initialize(SMSG_AUCTION_LIST_RESULT, (4 + 4 + 4) + 50 * ((16 + MAX_INSPECTED_ENCHANTMENT_SLOT * 3) * 4));
+    uint32 count = 0;
+    uint32 totalcount = 0;
+    _result << (uint32) 0;
+
+    AuctionHouseObject::BuildListAuctionPage(_result, _shortlist, _listfrom, _usableFilter ? &*_usableFilter : nullptr, count, totalcount);
+
+    _result.put<uint32>(0, count);
+    _result << (uint32) totalcount;
+    _result << (uint32) 300; // clientside search cooldown [ms] (gray search button)
+}
+
+void AsyncAuctionListingMgr::Update(Milliseconds diff)
+{
     {
-        data.put<uint32>(0, count);
-        data << (uint32) totalcount;
-        data << (uint32) 300; // clientside search cooldown [ms] (gray search button)
-        plr->GetSession()->SendPacket(&data);
+        std::lock_guard<std::mutex> guard(auctionListingTempLock);
+        auctionListingList.splice(auctionListingList.end(), auctionListingListTemp);
     }
 
-    return true;
+    std::list<AuctionListItemsDelayEvent> prepared;
+    for (auto itr = auctionListingList.begin(); itr != auctionListingList.end();)
+    {
+        auto current = itr++;
+        if (current->_pickupTimer > diff)
+        {
+            current->_pickupTimer -= diff;
+            continue;
+        }
+
+        if (current->Prepare())
+            prepared.splice(prepared.end(), auctionListingList, current);
+        else
+            auctionListingList.erase(current);
+    }
+
+    bool const notify = !prepared.empty();
+    std::list<AuctionListItemsDelayEvent> results;
+    {
+        std::lock_guard<std::mutex> guard(auctionSearchLock);
+        auctionSearchQueue.splice(auctionSearchQueue.end(), prepared);
+        results.swap(auctionSearchResults);
+    }
+
+    if (notify)
+        auctionSearchCondition.notify_one();
+
+    for (AuctionListItemsDelayEvent& result : results)
+        result.Complete();
+}
+
+void AsyncAuctionListingMgr::ProcessSearches(Milliseconds timeout)
+{
+    std::unique_lock<std::mutex> guard(auctionSearchLock);
+    if (!auctionSearchCondition.wait_for(guard, timeout, [] { return !auctionSearchQueue.empty(); }))
+        return;
+
+    while (!auctionSearchQueue.empty())
+    {
+        std::list<AuctionListItemsDelayEvent> search;
+        search.splice(search.end(), auctionSearchQueue, auctionSearchQueue.begin());
+
+        guard.unlock();
+        search.front().Execute();
+        guard.lock();
+
+        auctionSearchResults.splice(auctionSearchResults.end(), search);
+    }
 }
@@ -19,8 +19,13 @@
 #define __ASYNCAUCTIONLISTING_H
 
 #include "AuctionHouseMgr.h"
-
+#include "Item.h"
+#include <condition_variable>
+#include <list>
 #include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
 
 class AuctionListOwnerItemsDelayEvent : public BasicEvent
 {
@@ -36,6 +41,60 @@ private:
     ObjectGuid playerguid;
 };
 
+/// Read only copy of an auction and the item data listings send, taken on the world thread
+struct AuctionListingEntry
+{
+    AuctionEntry Auction;
+    ItemTemplate const* Proto;
+    uint32 Enchantments[MAX_INSPECTED_ENCHANTMENT_SLOT][3];         // id, duration, charges
+    int32 RandomPropertyId;
+    uint32 SuffixFactor;
+    uint32 Count;
+    uint32 SpellCharges;
+
+    void BuildAuctionInfo(WorldPacket& data) const;
+};
+
+/// Player data the "usable items" search filter needs, copied on the world thread so the
+/// listing thread never reads the live player. Decides with the same checks as Player::CanUseItem(Item*).
+struct AuctionUsableFilter
+{
+    explicit AuctionUsableFilter(Player const* player);
+
+    [[nodiscard]] bool CanUse(ItemTemplate const* proto) const;
+
+    // player state read by Acore::CanUseItemTemplate and Acore::CanUseItemProficiency
+    [[nodiscard]] TeamId GetTeamId(bool /*original*/) const { return _team; }
+    [[nodiscard]] uint8 getClass() const { return _class; }
+    [[nodiscard]] uint32 getClassMask() const { return _classMask; }
+    [[nodiscard]] uint32 getRaceMask() const { return _raceMask; }
+    [[nodiscard]] uint8 GetLevel() const { return _level; }
+    [[nodiscard]] bool HasSkill(uint32 skill) const { return _skills.count(skill) != 0; }
+    [[nodiscard]] uint16 GetSkillValue(uint32 skill) const;
+    [[nodiscard]] bool HasSpell(uint32 spell) const { return _spells.count(spell) != 0; }
+    [[nodiscard]] bool IsHolidayActive(HolidayIds holiday) const { return _holidays.count(holiday) != 0; }
+    [[nodiscard]] ReputationRank GetReputationRank(uint32 faction) const;
+
+private:
+    bool _alive;
+    TeamId _team;                                               // original team
+    uint8 _class;
+    uint32 _classMask;
+    uint32 _raceMask;
+    uint8 _level;
+    std::unordered_map<uint32, uint16> _skills;                 // learned skill lines and their values
+    std::unordered_map<uint32, ReputationRank> _reputationRanks; // every faction of Faction.dbc, including the race and class base ranks
+    std::unordered_set<uint32> _spells;                         // spells of the active spec
+    std::unordered_set<uint32> _holidays;                       // holidays of the active game events
+};
+
+/// Consistent view of an auction house used by the listing thread
+struct AuctionHouseSnapshot
+{
+    std::vector<std::shared_ptr<AuctionListingEntry const>> Auctions;           // ordered by auction id
+    std::map<uint32, std::vector<AuctionListingEntry const*>> AuctionsByCategory; // item class << 16 | subclass, ordered by auction id
+};
+
 class AuctionListItemsDelayEvent
 {
 public:
@@ -44,7 +103,12 @@ public:
         _pickupTimer(pickupTimer), _playerguid(playerguid), _creatureguid(creatureguid), _searchedname(searchedname), _listfrom(listfrom), _levelmin(levelmin), _levelmax(levelmax),_usable(usable),
         _auctionSlotID(auctionSlotID), _auctionMainCategory(auctionMainCategory), _auctionSubCategory(auctionSubCategory), _quality(quality), _getAll(getAll), _sortOrder(sortOrder) { }
 
-    bool Execute();
+    // world thread, resolves the auction house and takes its snapshot, returns false if the search is dropped
+    bool Prepare();
+    // listing thread, searches the snapshot and builds the result packet
+    void Execute();
+    // world thread, sends the result to the player
+    void Complete();
 
     Milliseconds _pickupTimer;
     ObjectGuid _playerguid;
@@ -60,23 +124,44 @@ public:
     uint32 _quality;
     uint8 _getAll;
     AuctionSortOrderVector _sortOrder;
+
+private:
+    void BuildResult();
+
+    AuctionHouseObject* _auctionHouse = nullptr;
+    std::shared_ptr<AuctionHouseSnapshot const> _snapshot;
+    LocaleConstant _locale = LOCALE_enUS;
+    LocaleConstant _dbcLocale = LOCALE_enUS;
+    Milliseconds _searchTimeout = Milliseconds::zero();
+    std::optional<AuctionUsableFilter> _usableFilter;
+
+    bool _found = false;
+    std::vector<AuctionListingEntry const*> _shortlist;
+    WorldPacket _result;
 };
 
+/// Auction searches are queued by the map threads, prepared and answered on the world thread
+/// and executed on the auction listing thread against a snapshot of the auction house.
 class AsyncAuctionListingMgr
 {
 public:
-    static void Update(Milliseconds diff) { auctionListingDiff += diff; }
-    static Milliseconds GetDiff() { return auctionListingDiff; }
-    static void ResetDiff() { auctionListingDiff = Milliseconds::zero(); }
-    static std::list<AuctionListItemsDelayEvent>& GetList() { return auctionListingList; }
+    // world thread
+    static void Update(Milliseconds diff);
     static std::list<AuctionListItemsDelayEvent>& GetTempList() { return auctionListingListTemp; }
     static std::mutex& GetTempLock() { return auctionListingTempLock; }
 
+    // listing thread, executes queued searches until the queue is empty or timeout passed without work
+    static void ProcessSearches(Milliseconds timeout);
+
 private:
-    static Milliseconds auctionListingDiff;
     static std::list<AuctionListItemsDelayEvent> auctionListingList;
     static std::list<AuctionListItemsDelayEvent> auctionListingListTemp;
     static std::mutex auctionListingTempLock;
+
+    static std::list<AuctionListItemsDelayEvent> auctionSearchQueue;
+    static std::list<AuctionListItemsDelayEvent> auctionSearchResults;
+    static std::mutex auctionSearchLock;
+    static std::condition_variable auctionSearchCondition;
 };
 
 #endif
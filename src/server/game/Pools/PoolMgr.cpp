@@ -132,9 +132,36 @@ template <class T>
 void PoolGroup<T>::AddEntry(PoolObject& poolitem, uint32 maxentries)
 {
     if (poolitem.chance != 0 && maxentries == 1)
+    {
         ExplicitlyChanced.push_back(poolitem);
+        ExplicitlyChancedSums.push_back((ExplicitlyChancedSums.empty() ? 0.0f : ExplicitlyChancedSums.back()) + poolitem.chance);
+    }
     else
         EqualChanced.push_back(poolitem);
+
+    MemberGuids.insert(std::upper_bound(MemberGuids.begin(), MemberGuids.end(), poolitem.guid), poolitem.guid);
+}
+
+// Method to rebuild the roll and member lookups after entries were removed
+template <class T>
+void PoolGroup<T>::RebuildLookups()
+{
+    ExplicitlyChancedSums.clear();
+    ExplicitlyChancedSums.reserve(ExplicitlyChanced.size());
+    float sum = 0.0f;
+    for (PoolObject const& obj : ExplicitlyChanced)
+    {
+        sum += obj.chance;
+        ExplicitlyChancedSums.push_back(sum);
+    }
+
+    MemberGuids.clear();
+    MemberGuids.reserve(ExplicitlyChanced.size() + EqualChanced.size());
+    for (PoolObject const& obj : ExplicitlyChanced)
+        MemberGuids.push_back(obj.guid);
+    for (PoolObject const& obj : EqualChanced)
+        MemberGuids.push_back(obj.guid);
+    std::sort(MemberGuids.begin(), MemberGuids.end());
 }
 
 // Method to check the chances are proper in this object pool
@@ -158,16 +185,23 @@ bool PoolGroup<T>::CheckPool() const
 template<class T>
 void PoolGroup<T>::DespawnObject(ActivePoolData& spawns, ObjectGuid::LowType guid)
 {
+    if (guid)
+    {
+        if (spawns.IsActiveObject<T>(guid) && IsMember(guid))
+        {
+            Despawn1Object(guid);
+            spawns.RemoveObject<T>(guid, poolId);
+        }
+        return;
+    }
+
     for (size_t i = 0; i < EqualChanced.size(); ++i)
     {
         // if spawned
         if (spawns.IsActiveObject<T>(EqualChanced[i].guid))
         {
-            if (!guid || EqualChanced[i].guid == guid)
-            {
-                Despawn1Object(EqualChanced[i].guid);
-                spawns.RemoveObject<T>(EqualChanced[i].guid, poolId);
-            }
+            Despawn1Object(EqualChanced[i].guid);
+            spawns.RemoveObject<T>(EqualChanced[i].guid, poolId);
         }
     }
 
@@ -176,11 +210,8 @@ void PoolGroup<T>::DespawnObject(ActivePoolData& spawns, ObjectGuid::LowType gui
         // spawned
         if (spawns.IsActiveObject<T>(ExplicitlyChanced[i].guid))
         {
-            if (!guid || ExplicitlyChanced[i].guid == guid)
-            {
-                Despawn1Object(ExplicitlyChanced[i].guid);
-                spawns.RemoveObject<T>(ExplicitlyChanced[i].guid, poolId);
-            }
+            Despawn1Object(ExplicitlyChanced[i].guid);
+            spawns.RemoveObject<T>(ExplicitlyChanced[i].guid, poolId);
         }
     }
 }
@@ -299,6 +330,48 @@ void PoolGroup<Pool>::RemoveOneRelation(uint32 child_pool_id)
             break;
         }
     }
+
+    RebuildLookups();
+}
+
+// Picks up to count not yet active objects of EqualChanced, each with the same chance.
+// While most of the pool is inactive (the usual node/rare spawn pool) random members are
+// probed directly so a respawn costs O(count) instead of a scan of the whole pool.
+template <class T>
+void PoolGroup<T>::RollEqualChanced(ActivePoolData const& spawns, uint32 count, std::vector<PoolObject>& rolledObjects)
+{
+    uint32 const size = EqualChanced.size();
+    uint32 const active = std::min(spawns.GetActiveObjectCount(poolId), size);
+
+    if (size - active >= 2 * count)
+    {
+        std::vector<uint32> picked;
+        picked.reserve(count);
+
+        for (uint32 attempts = 4 * count + 16; attempts && picked.size() < count; --attempts)
+        {
+            uint32 index = urand(0, size - 1);
+            if (spawns.IsActiveObject<T>(EqualChanced[index].guid) || std::find(picked.begin(), picked.end(), index) != picked.end())
+                continue;
+
+            picked.push_back(index);
+        }
+
+        if (picked.size() == count)
+        {
+            for (uint32 index : picked)
+                rolledObjects.push_back(EqualChanced[index]);
+            return;
+        }
+    }
+
+    // Crowded pool or unlucky probes, fall back to collecting every inactive member
+    std::copy_if(EqualChanced.begin(), EqualChanced.end(), std::back_inserter(rolledObjects), [&spawns](PoolObject const& object)
+    {
+        return !spawns.IsActiveObject<T>(object.guid);
+    });
+
+    Acore::Containers::RandomResize(rolledObjects, count);
 }
 
 template <class T>
@@ -324,29 +397,23 @@ void PoolGroup<T>::SpawnObject(ActivePoolData& spawns, uint32 limit, uint32 trig
         {
             float roll = (float)rand_chance();
 
-            for (PoolObject& obj : ExplicitlyChanced)
+            // First object whose running chance sum exceeds the roll, if that one is
+            // already active the next inactive object after it takes its place
+            size_t i = std::upper_bound(ExplicitlyChancedSums.begin(), ExplicitlyChancedSums.end(), roll) - ExplicitlyChancedSums.begin();
+            for (; i < ExplicitlyChanced.size(); ++i)
             {
-                roll -= obj.chance;
-
                 // Triggering object is marked as spawned at this time and can be also rolled (respawn case)
                 // so this need explicit check for this case
-                if (roll < 0 && (/*obj.guid == triggerFrom ||*/ !spawns.IsActiveObject<T>(obj.guid)))
+                if (/*ExplicitlyChanced[i].guid == triggerFrom ||*/ !spawns.IsActiveObject<T>(ExplicitlyChanced[i].guid))
                 {
-                    rolledObjects.push_back(obj);
+                    rolledObjects.push_back(ExplicitlyChanced[i]);
                     break;
                 }
             }
         }
 
         if (!EqualChanced.empty() && rolledObjects.empty())
-        {
-            std::copy_if(EqualChanced.begin(), EqualChanced.end(), std::back_inserter(rolledObjects), [/*triggerFrom, */&spawns](PoolObject const& object)
-            {
-                 return /*object.guid == triggerFrom ||*/ !spawns.IsActiveObject<T>(object.guid);
-            });
-
-            Acore::Containers::RandomResize(rolledObjects, count);
-        }
+            RollEqualChanced(spawns, count, rolledObjects);
 
         // try to spawn rolled objects
         for (PoolObject& obj : rolledObjects)
@@ -1149,3 +1216,6 @@ template void PoolMgr::UpdatePool<Pool>(uint32 pool_id, uint32 db_guid_or_pool_i
 template void PoolMgr::UpdatePool<GameObject>(uint32 pool_id, uint32 db_guid_or_pool_id);
 template void PoolMgr::UpdatePool<Creature>(uint32 pool_id, uint32 db_guid_or_pool_id);
 template void PoolMgr::UpdatePool<Quest>(uint32 pool_id, uint32 db_guid_or_pool_id);
+
+template class PoolGroup<Creature>;
+template class PoolGroup<GameObject>;
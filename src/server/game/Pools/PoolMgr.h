@@ -22,6 +22,7 @@
 #include "Define.h"
 #include "GameObject.h"
 #include "QuestDef.h"
+#include <algorithm>
 
 struct PoolTemplateData
 {
@@ -89,10 +90,20 @@ public:
         return EqualChanced.front().guid;
     }
     uint32 GetPoolId() const { return poolId; }
+    // Appends up to count randomly picked inactive members of EqualChanced to rolledObjects
+    void RollEqualChanced(ActivePoolData const& spawns, uint32 count, std::vector<PoolObject>& rolledObjects);
 private:
+    bool IsMember(uint32 guid) const { return std::binary_search(MemberGuids.begin(), MemberGuids.end(), guid); }
+    void RebuildLookups();
+
     uint32 poolId;
     PoolObjectList ExplicitlyChanced;
     PoolObjectList EqualChanced;
+
+    // Running sum of ExplicitlyChanced chances, the roll is resolved by binary search
+    std::vector<float> ExplicitlyChancedSums;
+    // Sorted guids of both lists, so a single member despawn doesn't need to walk the pool
+    std::vector<uint32> MemberGuids;
 };
 
 typedef std::multimap<uint32, uint32> PooledQuestRelation;
@@ -0,0 +1,69 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PacketBroadcast.h"
+#include "WorldSession.h"
+#include <array>
+#include <atomic>
+
+namespace
+{
+    struct BroadcastCounters
+    {
+        std::atomic<uint64> Broadcasts{0};
+        std::atomic<uint64> Recipients{0};
+        std::atomic<uint32> MaxRecipients{0};
+    };
+
+    // broadcasts are sent from the world and the map threads
+    std::array<BroadcastCounters, MAX_BROADCAST_SOURCE> Counters;
+
+    constexpr std::array<char const*, MAX_BROADCAST_SOURCE> SourceNames = { "group", "guild", "channel" };
+}
+
+PacketBroadcast::~PacketBroadcast()
+{
+    BroadcastCounters& counters = Counters[_source];
+    counters.Broadcasts.fetch_add(1, std::memory_order_relaxed);
+    counters.Recipients.fetch_add(_recipients, std::memory_order_relaxed);
+
+    uint32 max = counters.MaxRecipients.load(std::memory_order_relaxed);
+    while (_recipients > max && !counters.MaxRecipients.compare_exchange_weak(max, _recipients, std::memory_order_relaxed));
+}
+
+void PacketBroadcast::SendTo(WorldSession* session)
+{
+    session->SendPacket(_packet.Get());
+    ++_recipients;
+}
+
+std::vector<PacketBroadcast::Statistics> PacketBroadcast::CollectStatistics()
+{
+    std::vector<Statistics> statistics;
+    statistics.reserve(MAX_BROADCAST_SOURCE);
+
+    for (uint8 source = 0; source < MAX_BROADCAST_SOURCE; ++source)
+    {
+        BroadcastCounters& counters = Counters[source];
+        statistics.push_back({ SourceNames[source],
+            counters.Broadcasts.exchange(0, std::memory_order_relaxed),
+            counters.Recipients.exchange(0, std::memory_order_relaxed),
+            counters.MaxRecipients.exchange(0, std::memory_order_relaxed) });
+    }
+
+    return statistics;
+}
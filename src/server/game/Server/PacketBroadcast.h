@@ -0,0 +1,67 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PACKET_BROADCAST_H_
+#define _PACKET_BROADCAST_H_
+
+#include "WorldPacket.h"
+#include <vector>
+
+class WorldSession;
+
+enum BroadcastSource : uint8
+{
+    BROADCAST_SOURCE_GROUP,
+    BROADCAST_SOURCE_GUILD,
+    BROADCAST_SOURCE_CHANNEL,
+
+    MAX_BROADCAST_SOURCE
+};
+
+/// Sends one packet to many sessions. The payload is copied once, on first send, and shared
+/// by every recipient, the fan-out size is accounted to the source when the broadcast ends.
+class AC_GAME_API PacketBroadcast
+{
+public:
+    struct Statistics
+    {
+        char const* Source;
+        uint64 Broadcasts;
+        uint64 Recipients;
+        uint32 MaxRecipients;
+    };
+
+    PacketBroadcast(WorldPacket const* packet, BroadcastSource source) : _packet(packet), _source(source) { }
+    ~PacketBroadcast();
+
+    PacketBroadcast(PacketBroadcast const&) = delete;
+    PacketBroadcast& operator=(PacketBroadcast const&) = delete;
+
+    void SendTo(WorldSession* session);
+
+    [[nodiscard]] uint32 GetRecipients() const { return _recipients; }
+
+    /// Returns the totals of every source since the previous call and resets them
+    static std::vector<Statistics> CollectStatistics();
+
+private:
+    LazySharedWorldPacket _packet;
+    BroadcastSource _source;
+    uint32 _recipients = 0;
+};
+
+#endif
@@ -22,6 +22,7 @@
 #include "Common.h"
 #include "Duration.h"
 #include "Opcodes.h"
+#include <memory>
 
 class WorldPacket : public ByteBuffer
 {
@@ -83,4 +84,26 @@ protected:
     TimePoint m_receivedTime; // only set for a specific set of opcodes, for performance reasons.
 };
 
+// Immutable packet whose payload is shared by every socket it is sent to
+typedef std::shared_ptr<WorldPacket const> SharedWorldPacket;
+
+// Used by broadcasts: the payload is copied once, on first use, and then shared by all recipients
+class LazySharedWorldPacket
+{
+public:
+    explicit LazySharedWorldPacket(WorldPacket const* packet) : _packet(packet) { }
+
+    SharedWorldPacket const& Get()
+    {
+        if (!_shared)
+            _shared = std::make_shared<WorldPacket const>(*_packet);
+
+        return _shared;
+    }
+
+private:
+    WorldPacket const* _packet;
+    SharedWorldPacket _shared;
+};
+
 #endif
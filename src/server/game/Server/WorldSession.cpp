@@ -30,6 +30,7 @@
 #include "Guild.h"
 #include "GuildMgr.h"
 #include "Hyperlinks.h"
+#include "InstanceSaveMgr.h"
 #include "Log.h"
 #include "MapMgr.h"
 #include "Metric.h"
@@ -203,17 +204,17 @@ ObjectGuid::LowType WorldSession::GetGuidLow() const
     return GetPlayer() ? GetPlayer()->GetGUID().GetCounter() : 0;
 }
 
-/// Send a packet to the client
-void WorldSession::SendPacket(WorldPacket const* packet)
+/// Common checks and statistics for every outgoing packet, returns false if the packet must not be sent
+bool WorldSession::CanSendPacket(WorldPacket const* packet)
 {
     if (packet->GetOpcode() == NULL_OPCODE)
     {
         LOG_ERROR("network.opcode", "{} send NULL_OPCODE", GetPlayerInfo());
-        return;
+        return false;
     }
 
     if (!m_Socket)
-        return;
+        return false;
 
 #if defined(ACORE_DEBUG)
     // Code for network use statistic
@@ -253,13 +254,31 @@ void WorldSession::SendPacket(WorldPacket const* packet)
 
     if (!sScriptMgr->CanPacketSend(this, *packet))
     {
-        return;
+        return false;
     }
 
     LOG_TRACE("network.opcode", "S->C: {} {}", GetPlayerInfo(), GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())));
+    return true;
+}
+
+/// Send a packet to the client
+void WorldSession::SendPacket(WorldPacket const* packet)
+{
+    if (!CanSendPacket(packet))
+        return;
+
     m_Socket->SendPacket(*packet);
 }
 
+/// Send a packet whose payload is shared with other recipients, no copy of the payload is made
+void WorldSession::SendPacket(SharedWorldPacket const& packet)
+{
+    if (!CanSendPacket(packet.get()))
+        return;
+
+    m_Socket->SendPacket(packet);
+}
+
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
@@ -702,6 +721,7 @@ void WorldSession::LogoutPlayer(bool save)
         //! Broadcast a logout message to the player's friends
         sSocialMgr->SendFriendStatus(_player, FRIEND_OFFLINE, _player->GetGUID(), true);
         sSocialMgr->RemovePlayerSocial(_player->GetGUID());
+        sInstanceSaveMgr->PlayerUnloadBoundInstancesMaps(_player->GetGUID());
 
         //! Call script hook before deletion
         sScriptMgr->OnPlayerLogout(_player);
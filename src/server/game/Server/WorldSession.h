@@ -344,6 +344,7 @@ public:
     void WriteMovementInfo(WorldPacket* data, MovementInfo* mi);
 
     void SendPacket(WorldPacket const* packet);
+    void SendPacket(SharedWorldPacket const& packet);
     void SendNotification(const char* format, ...) ATTR_PRINTF(2, 3);
     void SendNotification(uint32 string_id, ...);
     void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName* declinedName);
@@ -1120,6 +1121,8 @@ protected:
     } AntiDOS;
 
 private:
+    bool CanSendPacket(WorldPacket const* packet);
+
     // private trade methods
     void moveItems(Item* myItems[], Item* hisItems[]);
 
@@ -50,6 +50,9 @@ AuraApplication::AuraApplication(Unit* target, Unit* caster, Aura* aura, uint8 e
 {
     ASSERT(GetTarget() && GetBase());
 
+    UpdateProcFlags();
+    _alwaysCheckProc = GetBase()->HasCheckProcScripts();
+
     if (GetBase()->CanBeSentToClient())
     {
         // Try find slot for aura
@@ -295,6 +298,11 @@ void AuraApplication::ClientUpdate(bool remove)
     _target->SendMessageToSet(&data, true);
 }
 
+void AuraApplication::UpdateProcFlags()
+{
+    _procFlags = GetBase()->GetProcEventFlags();
+}
+
 uint8 Aura::BuildEffectMaskForOwner(SpellInfo const* spellProto, uint8 avalibleEffectMask, WorldObject* owner)
 {
     ASSERT_NODEBUGINFO(spellProto);
@@ -2228,6 +2236,12 @@ void Aura::PrepareProcToTrigger(AuraApplication* aurApp, ProcEventInfo& eventInf
     AddProcCooldown(procEntry->Cooldown);
 }
 
+/// Proc flags Unit::IsTriggeredAtSpellProcEvent tests this aura against, 0 if it can never proc there
+uint32 Aura::GetProcEventFlags() const
+{
+    return sSpellMgr->GetSpellProcEventFlags(GetId());
+}
+
 bool Aura::IsProcTriggeredOnEvent(AuraApplication* aurApp, ProcEventInfo& eventInfo) const
 {
     SpellProcEntry const* procEntry = sSpellMgr->GetSpellProcEntry(GetId());
@@ -2634,6 +2648,15 @@ void Aura::CallScriptEffectSplitHandlers(AuraEffect* aurEff, AuraApplication con
     }
 }
 
+bool Aura::HasCheckProcScripts() const
+{
+    for (AuraScript const* script : m_loadedScripts)
+        if (!script->DoCheckProc.empty() || !script->DoAfterCheckProc.empty())
+            return true;
+
+    return false;
+}
+
 bool Aura::CallScriptCheckProcHandlers(AuraApplication const* aurApp, ProcEventInfo& eventInfo)
 {
     bool result = true;
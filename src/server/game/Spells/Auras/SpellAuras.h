@@ -18,6 +18,7 @@
 #ifndef ACORE_SPELLAURAS_H
 #define ACORE_SPELLAURAS_H
 
+#include "ObjectPool.h"
 #include "SpellAuraDefines.h"
 #include "Unit.h"
 
@@ -48,10 +49,13 @@ private:
     uint8 _flags;                                  // Aura info flag
     uint8 _effectsToApply;                         // Used only at spell hit to determine which effect should be applied
     bool _needClientUpdate: 1;
+    bool _alwaysCheckProc: 1;                      // Aura has CheckProc script hooks, checked on every proc event
 
     // xinef: stacking
     uint8 _disableMask;
 
+    uint32 _procFlags;                             // Proc flags checked in Unit::ProcDamageAndSpellFor, used by the unit proc index
+
     explicit AuraApplication(Unit* target, Unit* caster, Aura* base, uint8 effMask);
     void _Remove();
 private:
@@ -77,6 +81,10 @@ public:
     void BuildUpdatePacket(ByteBuffer& data, bool remove) const;
     void ClientUpdate(bool remove = false);
 
+    uint32 GetProcFlags() const { return _procFlags; }
+    bool IsAlwaysCheckingProc() const { return _alwaysCheckProc; }
+    void UpdateProcFlags();
+
     // xinef: stacking
     bool IsActive(uint8 effIdx) { return ((1 << effIdx) & _disableMask) == 0; }
     void SetDisableMask(uint8 effIdx) { _disableMask |= 1 << effIdx; }
@@ -97,6 +105,8 @@ public:
     void _InitEffects(uint8 effMask, Unit* caster, int32* baseAmount);
     virtual ~Aura();
 
+    OBJECT_POOL_ALLOCATED("Aura")
+
     SpellInfo const* GetSpellInfo() const { return m_spellInfo; }
     uint32 GetId() const;
 
@@ -201,6 +211,7 @@ public:
     void SetUsingCharges(bool val) { m_isUsingCharges = val; }
     void PrepareProcToTrigger(AuraApplication* aurApp, ProcEventInfo& eventInfo);
     bool IsProcTriggeredOnEvent(AuraApplication* aurApp, ProcEventInfo& eventInfo) const;
+    uint32 GetProcEventFlags() const;
     float CalcProcChance(SpellProcEntry const& procEntry, ProcEventInfo& eventInfo) const;
     void TriggerProcOnEvent(AuraApplication* aurApp, ProcEventInfo& eventInfo);
 
@@ -225,6 +236,7 @@ public:
     void CallScriptEffectSplitHandlers(AuraEffect* aurEff, AuraApplication const* aurApp, DamageInfo& dmgInfo, uint32& splitAmount);
 
     // Spell Proc Hooks
+    bool HasCheckProcScripts() const;
     bool CallScriptCheckProcHandlers(AuraApplication const* aurApp, ProcEventInfo& eventInfo);
     bool CallScriptAfterCheckProcHandlers(AuraApplication const* aurApp, ProcEventInfo& eventInfo, bool isTriggeredAtSpellProcEvent);
     bool CallScriptPrepareProcHandlers(AuraApplication const* aurApp, ProcEventInfo& eventInfo);
@@ -4860,6 +4860,7 @@ void Spell::EffectForceDeselect(SpellEffIndex /*effIndex*/)
     float dist = m_caster->GetVisibilityRange() + VISIBILITY_COMPENSATION;
     Acore::MessageDistDelivererToHostile notifier(m_caster, &data, dist);
     Cell::VisitWorldObjects(m_caster, notifier, dist);
+    notifier.Deliver();
 
     // xinef: we should also force pets to remove us from current target
     Unit::AttackerSet attackerSet;
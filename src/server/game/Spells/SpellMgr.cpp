@@ -352,7 +352,7 @@ bool IsDiminishingReturnsGroupDurationLimited(DiminishingGroup group)
     }
 }
 
-SpellMgr::SpellMgr()
+SpellMgr::SpellMgr() : mProcDataVersion(0)
 {
 }
 
@@ -658,22 +658,27 @@ SpellGroupStackFlags SpellMgr::GetGroupStackFlags(uint32 groupid) const
     return SPELL_GROUP_STACK_FLAG_NONE;
 }
 
-uint32 SpellMgr::GetSpellGroup(uint32 spell_id) const
+SpellStackInfo const* SpellMgr::_GetSpellStackInfo(uint32 firstRankId) const
 {
-    uint32 first_rank = GetFirstSpellInChain(spell_id);
-    SpellGroupMap::const_iterator itr = mSpellGroupMap.find(first_rank);
+    SpellGroupMap::const_iterator itr = mSpellGroupMap.find(firstRankId);
     if (itr != mSpellGroupMap.end())
-        return itr->second.groupId;
+        return &itr->second;
+
+    return nullptr;
+}
+
+uint32 SpellMgr::GetSpellGroup(uint32 spell_id) const
+{
+    if (SpellStackInfo const* stackInfo = _GetSpellStackInfo(GetFirstSpellInChain(spell_id)))
+        return stackInfo->groupId;
 
     return 0;
 }
 
 SpellGroupSpecialFlags SpellMgr::GetSpellGroupSpecialFlags(uint32 spell_id) const
 {
-    uint32 first_rank = GetFirstSpellInChain(spell_id);
-    SpellGroupMap::const_iterator itr = mSpellGroupMap.find(first_rank);
-    if (itr != mSpellGroupMap.end())
-        return itr->second.specialFlags;
+    if (SpellStackInfo const* stackInfo = _GetSpellStackInfo(GetFirstSpellInChain(spell_id)))
+        return stackInfo->specialFlags;
 
     return SPELL_GROUP_SPECIAL_FLAG_NONE;
 }
@@ -683,9 +688,11 @@ SpellGroupStackFlags SpellMgr::CheckSpellGroupStackRules(SpellInfo const* spellI
     uint32 spellid_1 = spellInfo1->GetFirstRankSpell()->Id;
     uint32 spellid_2 = spellInfo2->GetFirstRankSpell()->Id;
 
-    uint32 groupId = GetSpellGroup(spellid_1);
+    // both ids are first ranks already, resolve each group entry once
+    SpellStackInfo const* stackInfo1 = _GetSpellStackInfo(spellid_1);
+    uint32 groupId = stackInfo1 ? stackInfo1->groupId : 0;
 
-    SpellGroupSpecialFlags flag1 = GetSpellGroupSpecialFlags(spellid_1);
+    SpellGroupSpecialFlags flag1 = stackInfo1 ? stackInfo1->specialFlags : SPELL_GROUP_SPECIAL_FLAG_NONE;
 
     // xinef: dunno why i added this
     if (spellid_1 == spellid_2 && remove && !areaAura)
@@ -698,9 +705,13 @@ SpellGroupStackFlags SpellMgr::CheckSpellGroupStackRules(SpellInfo const* spellI
         return SPELL_GROUP_STACK_FLAG_NONE;
     }
 
-    if (groupId > 0 && groupId == GetSpellGroup(spellid_2))
+    if (!groupId)
+        return SPELL_GROUP_STACK_FLAG_NONE;
+
+    SpellStackInfo const* stackInfo2 = _GetSpellStackInfo(spellid_2);
+    if (stackInfo2 && groupId == stackInfo2->groupId)
     {
-        SpellGroupSpecialFlags flag2 = GetSpellGroupSpecialFlags(spellid_2);
+        SpellGroupSpecialFlags flag2 = stackInfo2->specialFlags;
         SpellGroupStackFlags additionFlag = SPELL_GROUP_STACK_FLAG_NONE;
         // xinef: first flags are used for elixir stacking rules
         if (flag1 & SPELL_GROUP_SPECIAL_FLAG_STACK_EXCLUSIVE_MAX && flag2 & SPELL_GROUP_SPECIAL_FLAG_STACK_EXCLUSIVE_MAX)
@@ -729,10 +740,13 @@ void SpellMgr::GetSetOfSpellsInSpellGroupWithFlag(uint32 group_id, SpellGroupSpe
 
 SpellProcEventEntry const* SpellMgr::GetSpellProcEvent(uint32 spellId) const
 {
-    SpellProcEventMap::const_iterator itr = mSpellProcEventMap.find(spellId);
-    if (itr != mSpellProcEventMap.end())
-        return &itr->second;
-    return nullptr;
+    // entries only exist for spells of the store
+    return spellId < mSpellHotData.size() ? mSpellHotData[spellId].ProcEvent : nullptr;
+}
+
+uint32 SpellMgr::GetSpellProcEventFlags(uint32 spellId) const
+{
+    return spellId < mSpellHotData.size() ? mSpellHotData[spellId].ProcEventFlags : 0;
 }
 
 bool SpellMgr::IsSpellProcEventCanTriggeredBy(SpellInfo const* spellProto, SpellProcEventEntry const* spellProcEvent, uint32 EventProcFlag, ProcEventInfo const& eventInfo, bool active) const
@@ -889,10 +903,7 @@ bool SpellMgr::IsSpellProcEventCanTriggeredBy(SpellInfo const* spellProto, Spell
 
 SpellProcEntry const* SpellMgr::GetSpellProcEntry(uint32 spellId) const
 {
-    SpellProcMap::const_iterator itr = mSpellProcMap.find(spellId);
-    if (itr != mSpellProcMap.end())
-        return &itr->second;
-    return nullptr;
+    return spellId < mSpellHotData.size() ? mSpellHotData[spellId].ProcEntry : nullptr;
 }
 
 bool SpellMgr::CanSpellTriggerProcOnEvent(SpellProcEntry const& procEntry, ProcEventInfo& eventInfo) const
@@ -1027,8 +1038,27 @@ bool SpellMgr::IsArenaAllowedEnchancment(uint32 ench_id) const
     return mEnchantCustomAttr[ench_id];
 }
 
+namespace
+{
+    // spell_linked_spell keys are +-(spell id + type * SPELL_LINKED_MAX_SPELLS), one bit per sign and type, 0 for types without a bit
+    uint8 GetSpellLinkedBit(int32 key)
+    {
+        uint32 type = std::abs(key) / SPELL_LINKED_MAX_SPELLS;
+        if (type >= 4)
+            return 0;
+
+        return uint8(1) << (type * 2 + (key < 0 ? 1 : 0));
+    }
+}
+
 const std::vector<int32>* SpellMgr::GetSpellLinked(int32 spell_id) const
 {
+    // most spells have no links, answer those without touching the map
+    uint32 spellId = std::abs(spell_id) % SPELL_LINKED_MAX_SPELLS;
+    uint8 linkedBit = GetSpellLinkedBit(spell_id);
+    if (linkedBit && spellId < mSpellHotData.size() && !(mSpellHotData[spellId].LinkedMask & linkedBit))
+        return nullptr;
+
     SpellLinkedMap::const_iterator itr = mSpellLinkedMap.find(spell_id);
     return itr != mSpellLinkedMap.end() ? &(itr->second) : nullptr;
 }
@@ -1740,12 +1770,14 @@ void SpellMgr::LoadSpellProcEvents()
     uint32 oldMSTime = getMSTime();
 
     mSpellProcEventMap.clear();                             // need for reload case
+    ++mProcDataVersion;
 
     //                                                0      1           2                3                 4                 5                 6          7       8          9             10       11
     QueryResult result = WorldDatabase.Query("SELECT entry, SchoolMask, SpellFamilyName, SpellFamilyMask0, SpellFamilyMask1, SpellFamilyMask2, procFlags, procEx, procPhase, ppmRate, CustomChance, Cooldown FROM spell_proc_event");
     if (!result)
     {
         LOG_WARN("server.loading", ">> Loaded 0 spell proc event conditions. DB table `spell_proc_event` is empty.");
+        _LoadSpellHotData();
         return;
     }
 
@@ -1825,6 +1857,8 @@ void SpellMgr::LoadSpellProcEvents()
         ++count;
     } while (result->NextRow());
 
+    _LoadSpellHotData();
+
     LOG_INFO("server.loading", ">> Loaded {} Extra Spell Proc Event Conditions in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
@@ -1834,6 +1868,7 @@ void SpellMgr::LoadSpellProcs()
     uint32 oldMSTime = getMSTime();
 
     mSpellProcMap.clear();                             // need for reload case
+    ++mProcDataVersion;
 
     //                                                 0        1           2                3                 4                 5                 6          7              8              9         10              11             12      13        14
     QueryResult result = WorldDatabase.Query("SELECT SpellId, SchoolMask, SpellFamilyName, SpellFamilyMask0, SpellFamilyMask1, SpellFamilyMask2, ProcFlags, SpellTypeMask, SpellPhaseMask, HitMask, AttributesMask, ProcsPerMinute, Chance, Cooldown, Charges FROM spell_proc");
@@ -1841,6 +1876,7 @@ void SpellMgr::LoadSpellProcs()
     {
         LOG_WARN("server.loading", ">> Loaded 0 Spell Proc Conditions And Data. DB table `spell_proc` Is Empty.");
         LOG_INFO("server.loading", " ");
+        _LoadSpellHotData();
         return;
     }
 
@@ -1957,6 +1993,8 @@ void SpellMgr::LoadSpellProcs()
         ++count;
     } while (result->NextRow());
 
+    _LoadSpellHotData();
+
     LOG_INFO("server.loading", ">> Loaded {} spell proc conditions and data in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
@@ -2262,6 +2300,7 @@ void SpellMgr::LoadSpellLinked()
     {
         LOG_WARN("server.loading", ">> Loaded 0 linked spells. DB table `spell_linked_spell` is empty.");
         LOG_INFO("server.loading", " ");
+        _LoadSpellHotData();
         return;
     }
 
@@ -2299,6 +2338,8 @@ void SpellMgr::LoadSpellLinked()
         ++count;
     } while (result->NextRow());
 
+    _LoadSpellHotData();
+
     LOG_INFO("server.loading", ">> Loaded {} Linked Spells in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
@@ -2728,6 +2769,32 @@ void SpellMgr::LoadSpellInfoStore()
     LOG_INFO("server.loading", " ");
 }
 
+void SpellMgr::_LoadSpellHotData()
+{
+    mSpellHotData.assign(GetSpellInfoStoreSize(), SpellHotData());
+
+    for (SpellProcMap::const_iterator itr = mSpellProcMap.begin(); itr != mSpellProcMap.end(); ++itr)
+        mSpellHotData[itr->first].ProcEntry = &itr->second;
+
+    for (SpellProcEventMap::const_iterator itr = mSpellProcEventMap.begin(); itr != mSpellProcEventMap.end(); ++itr)
+        mSpellHotData[itr->first].ProcEvent = &itr->second;
+
+    for (uint32 spellId = 0; spellId < GetSpellInfoStoreSize(); ++spellId)
+    {
+        SpellHotData& hotData = mSpellHotData[spellId];
+        if (!mSpellInfoMap[spellId] || hotData.ProcEntry)
+            continue;
+
+        if (hotData.ProcEvent && hotData.ProcEvent->procFlags)
+            hotData.ProcEventFlags = hotData.ProcEvent->procFlags;
+        else
+            hotData.ProcEventFlags = mSpellInfoMap[spellId]->ProcFlags;
+    }
+
+    for (SpellLinkedMap::const_iterator itr = mSpellLinkedMap.begin(); itr != mSpellLinkedMap.end(); ++itr)
+        mSpellHotData[std::abs(itr->first) % SPELL_LINKED_MAX_SPELLS].LinkedMask |= GetSpellLinkedBit(itr->first);
+}
+
 void SpellMgr::LoadSpellCooldownOverrides()
 {
     uint32 oldMSTime = getMSTime();
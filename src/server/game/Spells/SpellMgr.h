@@ -377,8 +377,8 @@ struct SpellStackInfo
     SpellGroupSpecialFlags specialFlags;
 };
 //             spell_id, group_id
-typedef std::map<uint32, SpellStackInfo> SpellGroupMap;
-typedef std::map<uint32, SpellGroupStackFlags> SpellGroupStackMap;
+typedef std::unordered_map<uint32, SpellStackInfo> SpellGroupMap;
+typedef std::unordered_map<uint32, SpellGroupStackFlags> SpellGroupStackMap;
 
 struct SpellThreatEntry
 {
@@ -388,7 +388,7 @@ struct SpellThreatEntry
 };
 
 typedef std::unordered_map<uint32, SpellThreatEntry> SpellThreatMap;
-typedef std::map<uint32, float> SpellMixologyMap;
+typedef std::unordered_map<uint32, float> SpellMixologyMap;
 
 // coordinates for spells (accessed using SpellMgr functions)
 struct SpellTargetPosition
@@ -513,7 +513,7 @@ private:
     bool removeOnChangePet{false};
     int32 damage{0};
 };
-typedef std::map<uint32, PetAura> SpellPetAuraMap;
+typedef std::unordered_map<uint32, PetAura> SpellPetAuraMap;
 
 enum ICCBuff
 {
@@ -585,7 +585,7 @@ typedef std::pair<SkillLineAbilityMap::const_iterator, SkillLineAbilityMap::cons
 typedef std::multimap<uint32, uint32> PetLevelupSpellSet;
 typedef std::map<uint32, PetLevelupSpellSet> PetLevelupSpellMap;
 
-typedef std::map<uint32, uint32> SpellDifficultySearcherMap;
+typedef std::unordered_map<uint32, uint32> SpellDifficultySearcherMap;
 
 struct PetDefaultSpellsEntry
 {
@@ -600,7 +600,19 @@ typedef std::vector<bool> EnchantCustomAttribute;
 
 typedef std::vector<SpellInfo*> SpellInfoMap;
 
-typedef std::map<int32, std::vector<int32> > SpellLinkedMap;
+typedef std::unordered_map<int32, std::vector<int32> > SpellLinkedMap;
+
+// What the proc and cast paths look up for every aura and spell, resolved per spell id at load
+// so a lookup is one index into a compact array instead of hash lookups and SpellInfo reads
+struct SpellHotData
+{
+    SpellProcEntry const* ProcEntry = nullptr;
+    SpellProcEventEntry const* ProcEvent = nullptr;
+    uint32 ProcEventFlags = 0;                              // flags Unit::IsTriggeredAtSpellProcEvent tests, 0 if the spell has a spell_proc entry
+    uint8 LinkedMask = 0;                                   // bit per spell_linked_spell key of the spell, see GetSpellLinkedBit
+};
+
+typedef std::vector<SpellHotData> SpellHotDataMap;
 
 struct SpellCooldownOverride
 {
@@ -610,7 +622,7 @@ struct SpellCooldownOverride
     uint32 StartRecoveryCategory;
 };
 
-typedef std::map<uint32, SpellCooldownOverride> SpellCooldownOverrideMap;
+typedef std::unordered_map<uint32, SpellCooldownOverride> SpellCooldownOverrideMap;
 
 bool IsPrimaryProfessionSkill(uint32 skill);
 
@@ -687,12 +699,17 @@ public:
 
     // Spell proc event table
     [[nodiscard]] SpellProcEventEntry const* GetSpellProcEvent(uint32 spellId) const;
+    // procFlags of the spell_proc_event entry if set, else the spell's own, 0 if spell_proc handles the spell
+    [[nodiscard]] uint32 GetSpellProcEventFlags(uint32 spellId) const;
     bool IsSpellProcEventCanTriggeredBy(SpellInfo const* spellProto, SpellProcEventEntry const* spellProcEvent, uint32 EventProcFlag, ProcEventInfo const& eventInfo, bool active) const;
 
     // Spell proc table
     [[nodiscard]] SpellProcEntry const* GetSpellProcEntry(uint32 spellId) const;
     bool CanSpellTriggerProcOnEvent(SpellProcEntry const& procEntry, ProcEventInfo& eventInfo) const;
 
+    // Changes every time spell_proc_event or spell_proc is (re)loaded, units rebuild their proc index when it does
+    [[nodiscard]] uint32 GetProcDataVersion() const { return mProcDataVersion; }
+
     // Spell bonus data table
     [[nodiscard]] SpellBonusEntry const* GetSpellBonusData(uint32 spellId) const;
 
@@ -757,6 +774,10 @@ public:
 
 private:
     SpellInfo* _GetSpellInfo(uint32 spellId) { return spellId < GetSpellInfoStoreSize() ? mSpellInfoMap[spellId] : nullptr; }
+    // takes an already resolved first rank, skipping the chain lookup done by GetSpellGroup
+    [[nodiscard]] SpellStackInfo const* _GetSpellStackInfo(uint32 firstRankId) const;
+    // rebuilds mSpellHotData, called whenever one of the tables it is resolved from is (re)loaded
+    void _LoadSpellHotData();
 
     // Modifiers
 public:
@@ -817,8 +838,10 @@ private:
     PetLevelupSpellMap         mPetLevelupSpellMap;
     PetDefaultSpellsMap        mPetDefaultSpellsMap;           // only spells not listed in related mPetLevelupSpellMap entry
     SpellInfoMap               mSpellInfoMap;
+    SpellHotDataMap            mSpellHotData;
     SpellCooldownOverrideMap   mSpellCooldownOverrideMap;
     TalentAdditionalSet        mTalentSpellAdditionalSet;
+    uint32                     mProcDataVersion;
 };
 
 #define sSpellMgr SpellMgr::instance()
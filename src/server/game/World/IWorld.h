@@ -104,6 +104,7 @@ enum WorldBoolConfigs
     CONFIG_TALENTS_INSPECTING,
     CONFIG_CHAT_FAKE_MESSAGE_PREVENTING,
     CONFIG_CHAT_MUTE_FIRST_LOGIN,
+    CONFIG_CHAT_CHANNEL_BATCHING,
     CONFIG_DEATH_CORPSE_RECLAIM_DELAY_PVP,
     CONFIG_DEATH_CORPSE_RECLAIM_DELAY_PVE,
     CONFIG_DEATH_BONES_WORLD,
@@ -183,6 +184,7 @@ enum WorldBoolConfigs
     CONFIG_STRICT_NAMES_RESERVED,
     CONFIG_STRICT_NAMES_PROFANITY,
     CONFIG_ALLOWS_RANK_MOD_FOR_PET_HEALTH,
+    CONFIG_MOVEMENT_COALESCE_BROADCASTS,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -229,6 +231,7 @@ enum WorldIntConfigs
     CONFIG_CHARACTERS_PER_ACCOUNT,
     CONFIG_CHARACTERS_PER_REALM,
     CONFIG_CREATURE_STOP_FOR_PLAYER,
+    CONFIG_CREATURE_IDLE_UPDATE_INTERVAL,
     CONFIG_HEROIC_CHARACTERS_PER_REALM,
     CONFIG_CHARACTER_CREATING_MIN_LEVEL_FOR_HEROIC_CHARACTER,
     CONFIG_SKIP_CINEMATICS,
@@ -278,7 +281,14 @@ enum WorldIntConfigs
     CONFIG_CHATFLOOD_ADDON_MESSAGE_COUNT,
     CONFIG_CHATFLOOD_ADDON_MESSAGE_DELAY,
     CONFIG_CHATFLOOD_MUTE_TIME,
+    CONFIG_CHAT_CHANNEL_BATCHING_MIN_MEMBERS,
+    CONFIG_CHAT_CHANNEL_BATCHING_MESSAGES_PER_UPDATE,
+    CONFIG_CHAT_CHANNEL_BATCHING_QUEUE_SIZE,
+    CONFIG_CHAT_CHANNEL_BATCHING_MAX_PENDING_PER_PLAYER,
     CONFIG_EVENT_ANNOUNCE,
+    CONFIG_GAME_EVENT_SPAWNS_PER_MAP_UPDATE,
+    CONFIG_OBJECT_POOL_TRIM_INTERVAL,
+    CONFIG_OBJECT_POOL_TRIM_KEEP_FREE_KB,
     CONFIG_CREATURE_FAMILY_ASSISTANCE_DELAY,
     CONFIG_CREATURE_FAMILY_ASSISTANCE_PERIOD,
     CONFIG_CREATURE_FAMILY_FLEE_DELAY,
@@ -334,6 +344,9 @@ enum WorldIntConfigs
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_PLAYER_ALLOW_COMMANDS,
     CONFIG_NUMTHREADS,
+    CONFIG_STARTUP_LOADER_THREADS,
+    CONFIG_GRID_UNLOAD_IDLE_TIME,
+    CONFIG_GRID_UNLOAD_MAX_GRIDS,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_TELEPORT_TIMEOUT_NEAR, // pussywizard
@@ -0,0 +1,128 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StartupLoader.h"
+#include "Errors.h"
+#include "Log.h"
+#include "Timer.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+void StartupLoaderGraph::Add(std::string name, LoaderFunction loader, std::initializer_list<std::string_view> dependencies)
+{
+    std::size_t const index = _loaders.size();
+
+    _loaders.emplace_back();
+    _loaders[index].Name = std::move(name);
+    _loaders[index].Function = std::move(loader);
+
+    for (std::string_view dependency : dependencies)
+    {
+        auto itr = std::find_if(_loaders.begin(), _loaders.begin() + index, [dependency](Loader const& other) { return other.Name == dependency; });
+        if (itr == _loaders.begin() + index)
+            ABORT("Startup loader {} depends on {} which is not registered before it", _loaders[index].Name, dependency);
+
+        itr->Dependents.push_back(index);
+        ++_loaders[index].PendingDependencies;
+    }
+}
+
+void StartupLoaderGraph::Execute(Loader& loader)
+{
+    uint32 oldMSTime = getMSTime();
+    loader.Function();
+    loader.Duration = GetMSTimeDiffToNow(oldMSTime);
+}
+
+void StartupLoaderGraph::Run(uint32 threads)
+{
+    uint32 oldMSTime = getMSTime();
+
+    threads = std::max<uint32>(1, std::min<uint32>(threads, _loaders.size()));
+
+    if (threads == 1)
+    {
+        for (Loader& loader : _loaders)
+            Execute(loader);
+    }
+    else
+    {
+        std::mutex lock;
+        std::condition_variable stateChanged;
+        std::deque<std::size_t> ready;
+        std::size_t remaining = _loaders.size();
+
+        for (std::size_t i = 0; i < _loaders.size(); ++i)
+            if (!_loaders[i].PendingDependencies)
+                ready.push_back(i);
+
+        auto worker = [&]()
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            while (true)
+            {
+                stateChanged.wait(guard, [&] { return !ready.empty() || !remaining; });
+                if (!remaining)
+                    return;
+
+                std::size_t index = ready.front();
+                ready.pop_front();
+
+                guard.unlock();
+                Execute(_loaders[index]);
+                guard.lock();
+
+                --remaining;
+                for (std::size_t dependent : _loaders[index].Dependents)
+                    if (!--_loaders[dependent].PendingDependencies)
+                        ready.push_back(dependent);
+
+                stateChanged.notify_all();
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (uint32 i = 0; i < threads; ++i)
+            workers.emplace_back(worker);
+
+        for (std::thread& thread : workers)
+            thread.join();
+    }
+
+    std::vector<Loader const*> byDuration;
+    byDuration.reserve(_loaders.size());
+    for (Loader const& loader : _loaders)
+        byDuration.push_back(&loader);
+
+    std::stable_sort(byDuration.begin(), byDuration.end(), [](Loader const* left, Loader const* right) { return left->Duration > right->Duration; });
+
+    LOG_INFO("server.loading", ">> Ran {} loaders on {} thread(s) in {} ms", _loaders.size(), threads, GetMSTimeDiffToNow(oldMSTime));
+    // the slowest loaders are what matters when tuning startup, the full list is only shown at debug level
+    for (std::size_t i = 0; i < byDuration.size(); ++i)
+    {
+        if (i < 10)
+            LOG_INFO("server.loading", "    {:<32} {} ms", byDuration[i]->Name, byDuration[i]->Duration);
+        else
+            LOG_DEBUG("server.loading", "    {:<32} {} ms", byDuration[i]->Name, byDuration[i]->Duration);
+    }
+
+    _loaders.clear();
+}
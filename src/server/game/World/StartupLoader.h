@@ -0,0 +1,58 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _STARTUP_LOADER_H_
+#define _STARTUP_LOADER_H_
+
+#include "Define.h"
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// Runs a set of startup loaders with explicit dependencies.
+/// A loader may only depend on loaders registered before it, so registration order
+/// is always a valid sequential order and the graph can never contain cycles.
+/// Loaders running side by side must not touch each other's storages.
+class AC_GAME_API StartupLoaderGraph
+{
+public:
+    typedef std::function<void()> LoaderFunction;
+
+    void Add(std::string name, LoaderFunction loader, std::initializer_list<std::string_view> dependencies = {});
+
+    /// Executes all registered loaders on up to `threads` workers (1 keeps the calling thread only),
+    /// then reports per loader timings and clears the graph.
+    void Run(uint32 threads);
+
+private:
+    struct Loader
+    {
+        std::string Name;
+        LoaderFunction Function;
+        std::vector<std::size_t> Dependents;
+        uint32 PendingDependencies = 0;
+        uint32 Duration = 0;
+    };
+
+    static void Execute(Loader& loader);
+
+    std::vector<Loader> _loaders;
+};
+
+#endif
@@ -65,6 +65,7 @@
 #include "Metric.h"
 #include "M2Stores.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "Opcodes.h"
 #include "OutdoorPvPMgr.h"
 #include "PetitionMgr.h"
@@ -78,6 +79,7 @@
 #include "SkillExtraItems.h"
 #include "SmartAI.h"
 #include "SpellMgr.h"
+#include "StartupLoader.h"
 #include "TaskScheduler.h"
 #include "TicketMgr.h"
 #include "Transport.h"
@@ -946,6 +948,8 @@ void World::LoadConfigSettings(bool reload)
 
     _bool_configs[CONFIG_OBJECT_QUEST_MARKERS] = sConfigMgr->GetOption<bool>("Visibility.ObjectQuestMarkers", true);
 
+    _bool_configs[CONFIG_MOVEMENT_COALESCE_BROADCASTS] = sConfigMgr->GetOption<bool>("Movement.CoalesceBroadcasts", false);
+
     _int_configs[CONFIG_MAIL_DELIVERY_DELAY]   = sConfigMgr->GetOption<int32>("MailDeliveryDelay", HOUR);
 
     _int_configs[CONFIG_UPTIME_UPDATE]         = sConfigMgr->GetOption<int32>("UpdateUptimeInterval", 10);
@@ -1033,7 +1037,27 @@ void World::LoadConfigSettings(bool reload)
     _bool_configs[CONFIG_CHAT_MUTE_FIRST_LOGIN]     = sConfigMgr->GetOption<bool>("Chat.MuteFirstLogin", false);
     _int_configs[CONFIG_CHAT_TIME_MUTE_FIRST_LOGIN] = sConfigMgr->GetOption<int32>("Chat.MuteTimeFirstLogin", 120);
 
+    _bool_configs[CONFIG_CHAT_CHANNEL_BATCHING]                        = sConfigMgr->GetOption<bool>("ChatChannel.Batching.Enable", false);
+    _int_configs[CONFIG_CHAT_CHANNEL_BATCHING_MIN_MEMBERS]             = sConfigMgr->GetOption<int32>("ChatChannel.Batching.MinMembers", 200);
+    _int_configs[CONFIG_CHAT_CHANNEL_BATCHING_MESSAGES_PER_UPDATE]     = sConfigMgr->GetOption<int32>("ChatChannel.Batching.MessagesPerUpdate", 5);
+    _int_configs[CONFIG_CHAT_CHANNEL_BATCHING_QUEUE_SIZE]              = sConfigMgr->GetOption<int32>("ChatChannel.Batching.QueueSize", 50);
+    _int_configs[CONFIG_CHAT_CHANNEL_BATCHING_MAX_PENDING_PER_PLAYER]  = sConfigMgr->GetOption<int32>("ChatChannel.Batching.MaxPendingPerPlayer", 2);
+    if (_int_configs[CONFIG_CHAT_CHANNEL_BATCHING_MESSAGES_PER_UPDATE] < 1)
+    {
+        LOG_ERROR("server.loading", "ChatChannel.Batching.MessagesPerUpdate ({}) must be > 0. Using 1 instead.", _int_configs[CONFIG_CHAT_CHANNEL_BATCHING_MESSAGES_PER_UPDATE]);
+        _int_configs[CONFIG_CHAT_CHANNEL_BATCHING_MESSAGES_PER_UPDATE] = 1;
+    }
+
     _int_configs[CONFIG_EVENT_ANNOUNCE] = sConfigMgr->GetOption<int32>("Event.Announce", 0);
+    _int_configs[CONFIG_GAME_EVENT_SPAWNS_PER_MAP_UPDATE] = sConfigMgr->GetOption<int32>("GameEvent.SpawnsPerMapUpdate", 200);
+
+    _int_configs[CONFIG_OBJECT_POOL_TRIM_INTERVAL] = sConfigMgr->GetOption<int32>("ObjectPool.TrimInterval", 5);
+    _int_configs[CONFIG_OBJECT_POOL_TRIM_KEEP_FREE_KB] = sConfigMgr->GetOption<int32>("ObjectPool.TrimKeepFreeKB", 1024);
+    if (reload)
+    {
+        _timers[WUPDATE_OBJECT_POOL_TRIM].SetInterval(_int_configs[CONFIG_OBJECT_POOL_TRIM_INTERVAL] * MINUTE * IN_MILLISECONDS);
+        _timers[WUPDATE_OBJECT_POOL_TRIM].Reset();
+    }
 
     _float_configs[CONFIG_CREATURE_FAMILY_FLEE_ASSISTANCE_RADIUS] = sConfigMgr->GetOption<float>("CreatureFamilyFleeAssistanceRadius", 30.0f);
     _float_configs[CONFIG_CREATURE_FAMILY_ASSISTANCE_RADIUS]      = sConfigMgr->GetOption<float>("CreatureFamilyAssistanceRadius", 10.0f);
@@ -1190,6 +1214,7 @@ void World::LoadConfigSettings(bool reload)
 
     _bool_configs[CONFIG_OFFHAND_CHECK_AT_SPELL_UNLEARN]            = sConfigMgr->GetOption<bool>("OffhandCheckAtSpellUnlearn", true);
     _int_configs[CONFIG_CREATURE_STOP_FOR_PLAYER]                   = sConfigMgr->GetOption<uint32>("Creature.MovingStopTimeForPlayer", 3 * MINUTE * IN_MILLISECONDS);
+    _int_configs[CONFIG_CREATURE_IDLE_UPDATE_INTERVAL]              = sConfigMgr->GetOption<uint32>("Creature.IdleUpdateInterval", 0);
 
     _int_configs[CONFIG_WATER_BREATH_TIMER]                       = sConfigMgr->GetOption<uint32>("WaterBreath.Timer", 180000);
     if (_int_configs[CONFIG_WATER_BREATH_TIMER] <= 0)
@@ -1345,6 +1370,9 @@ void World::LoadConfigSettings(bool reload)
     _bool_configs[CONFIG_SHOW_MUTE_IN_WORLD]         = sConfigMgr->GetOption<bool>("ShowMuteInWorld", false);
     _bool_configs[CONFIG_SHOW_BAN_IN_WORLD]          = sConfigMgr->GetOption<bool>("ShowBanInWorld", false);
     _int_configs[CONFIG_NUMTHREADS]                  = sConfigMgr->GetOption<int32>("MapUpdate.Threads", 1);
+    _int_configs[CONFIG_STARTUP_LOADER_THREADS]      = sConfigMgr->GetOption<int32>("StartupLoader.Threads", 1);
+    _int_configs[CONFIG_GRID_UNLOAD_IDLE_TIME]       = sConfigMgr->GetOption<int32>("GridUnload.IdleTime", 0);
+    _int_configs[CONFIG_GRID_UNLOAD_MAX_GRIDS]       = sConfigMgr->GetOption<int32>("GridUnload.MaxGridsPerMap", 0);
     _int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = sConfigMgr->GetOption<int32>("Command.LookupMaxResults", 0);
 
     // Warden
@@ -1557,7 +1585,7 @@ void World::SetInitialWorldSettings()
 
     ///- Load the DBC files
     LOG_INFO("server.loading", "Initialize Data Stores...");
-    LoadDBCStores(_dataPath);
+    LoadDBCStores(_dataPath, getIntConfig(CONFIG_STARTUP_LOADER_THREADS));
     DetectDBCLang();
 
     // Load cinematic cameras
@@ -1626,24 +1654,25 @@ void World::SetInitialWorldSettings()
     LOG_INFO("server.loading", "Loading Instances...");
     sInstanceSaveMgr->LoadInstances();
 
-    LOG_INFO("server.loading", "Loading Broadcast Texts...");
-    sObjectMgr->LoadBroadcastTexts();
-    sObjectMgr->LoadBroadcastTextLocales();
-
-    LOG_INFO("server.loading", "Loading Localization Strings...");
+    ///- Broadcast texts and localization strings each fill their own storage, so they may load side by side
+    LOG_INFO("server.loading", "Loading Broadcast Texts and Localization Strings...");
     uint32 oldMSTime = getMSTime();
-    sObjectMgr->LoadCreatureLocales();
-    sObjectMgr->LoadGameObjectLocales();
-    sObjectMgr->LoadItemLocales();
-    sObjectMgr->LoadItemSetNameLocales();
-    sObjectMgr->LoadQuestLocales();
-    sObjectMgr->LoadQuestOfferRewardLocale();
-    sObjectMgr->LoadQuestRequestItemsLocale();
-    sObjectMgr->LoadNpcTextLocales();
-    sObjectMgr->LoadPageTextLocales();
-    sObjectMgr->LoadGossipMenuItemsLocales();
-    sObjectMgr->LoadPointOfInterestLocales();
-    sObjectMgr->LoadPetNamesLocales();
+    StartupLoaderGraph localeLoaders;
+    localeLoaders.Add("Broadcast Texts", [] { sObjectMgr->LoadBroadcastTexts(); });
+    localeLoaders.Add("Broadcast Text Locales", [] { sObjectMgr->LoadBroadcastTextLocales(); }, { "Broadcast Texts" });
+    localeLoaders.Add("Creature Locales", [] { sObjectMgr->LoadCreatureLocales(); });
+    localeLoaders.Add("GameObject Locales", [] { sObjectMgr->LoadGameObjectLocales(); });
+    localeLoaders.Add("Item Locales", [] { sObjectMgr->LoadItemLocales(); });
+    localeLoaders.Add("Item Set Name Locales", [] { sObjectMgr->LoadItemSetNameLocales(); });
+    localeLoaders.Add("Quest Locales", [] { sObjectMgr->LoadQuestLocales(); });
+    localeLoaders.Add("Quest Offer Reward Locales", [] { sObjectMgr->LoadQuestOfferRewardLocale(); });
+    localeLoaders.Add("Quest Request Items Locales", [] { sObjectMgr->LoadQuestRequestItemsLocale(); });
+    localeLoaders.Add("Npc Text Locales", [] { sObjectMgr->LoadNpcTextLocales(); });
+    localeLoaders.Add("Page Text Locales", [] { sObjectMgr->LoadPageTextLocales(); });
+    localeLoaders.Add("Gossip Menu Items Locales", [] { sObjectMgr->LoadGossipMenuItemsLocales(); });
+    localeLoaders.Add("Point Of Interest Locales", [] { sObjectMgr->LoadPointOfInterestLocales(); });
+    localeLoaders.Add("Pet Names Locales", [] { sObjectMgr->LoadPetNamesLocales(); });
+    localeLoaders.Run(getIntConfig(CONFIG_STARTUP_LOADER_THREADS));
 
     sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
     LOG_INFO("server.loading", ">> Localization Strings loaded in {} ms", GetMSTimeDiffToNow(oldMSTime));
@@ -2066,6 +2095,8 @@ void World::SetInitialWorldSettings()
 
     _timers[WUPDATE_WHO_LIST].SetInterval(5 * IN_MILLISECONDS); // update who list cache every 5 seconds
 
+    _timers[WUPDATE_OBJECT_POOL_TRIM].SetInterval(getIntConfig(CONFIG_OBJECT_POOL_TRIM_INTERVAL) * MINUTE * IN_MILLISECONDS);
+
     _mail_expire_check_timer = GameTime::GetGameTime() + 6h;
 
     ///- Initialize MapMgr
@@ -2311,6 +2342,14 @@ void World::Update(uint32 diff)
         sWhoListCacheMgr->Update();
     }
 
+    if (getIntConfig(CONFIG_OBJECT_POOL_TRIM_INTERVAL) && _timers[WUPDATE_OBJECT_POOL_TRIM].Passed())
+    {
+        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Trim object pools"));
+        _timers[WUPDATE_OBJECT_POOL_TRIM].Reset();
+        if (std::size_t released = ObjectPool::TrimAll(std::size_t(getIntConfig(CONFIG_OBJECT_POOL_TRIM_KEEP_FREE_KB)) * 1024))
+            LOG_DEBUG("server", "Object pools released {} KB to the system allocator", released / 1024);
+    }
+
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Check quest reset times"));
 
@@ -2373,6 +2412,11 @@ void World::Update(uint32 diff)
     METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update sessions"));
     UpdateSessions(diff);
 
+    {
+        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update channels"));
+        ChannelMgr::Update();
+    }
+
     /// <li> Handle weather updates when the timer has passed
     if (_timers[WUPDATE_WEATHERS].Passed())
     {
@@ -2532,6 +2576,7 @@ void World::ForceGameEventUpdate()
 /// Send a packet to all players (except self if mentioned)
 void World::SendGlobalMessage(WorldPacket const* packet, WorldSession* self, TeamId teamId)
 {
+    LazySharedWorldPacket sharedPacket(packet);
     SessionMap::const_iterator itr;
     for (itr = _sessions.begin(); itr != _sessions.end(); ++itr)
     {
@@ -2541,7 +2586,7 @@ void World::SendGlobalMessage(WorldPacket const* packet, WorldSession* self, Tea
                 itr->second != self &&
                 (teamId == TEAM_NEUTRAL || itr->second->GetPlayer()->GetTeamId() == teamId))
         {
-            itr->second->SendPacket(packet);
+            itr->second->SendPacket(sharedPacket.Get());
         }
     }
 }
@@ -2549,6 +2594,7 @@ void World::SendGlobalMessage(WorldPacket const* packet, WorldSession* self, Tea
 /// Send a packet to all GMs (except self if mentioned)
 void World::SendGlobalGMMessage(WorldPacket const* packet, WorldSession* self, TeamId teamId)
 {
+    LazySharedWorldPacket sharedPacket(packet);
     SessionMap::iterator itr;
     for (itr = _sessions.begin(); itr != _sessions.end(); ++itr)
     {
@@ -2559,7 +2605,7 @@ void World::SendGlobalGMMessage(WorldPacket const* packet, WorldSession* self, T
                 !AccountMgr::IsPlayerAccount(itr->second->GetSecurity()) &&
                 (teamId == TEAM_NEUTRAL || itr->second->GetPlayer()->GetTeamId() == teamId))
         {
-            itr->second->SendPacket(packet);
+            itr->second->SendPacket(sharedPacket.Get());
         }
     }
 }
@@ -2702,6 +2748,7 @@ void World::SendGlobalText(const char* text, WorldSession* self)
 /// Send a packet to all players (or players selected team) in the zone (except self if mentioned)
 bool World::SendZoneMessage(uint32 zone, WorldPacket const* packet, WorldSession* self, TeamId teamId)
 {
+    LazySharedWorldPacket sharedPacket(packet);
     bool foundPlayerToSend = false;
     SessionMap::const_iterator itr;
 
@@ -2714,7 +2761,7 @@ bool World::SendZoneMessage(uint32 zone, WorldPacket const* packet, WorldSession
                 itr->second != self &&
                 (teamId == TEAM_NEUTRAL || itr->second->GetPlayer()->GetTeamId() == teamId))
         {
-            itr->second->SendPacket(packet);
+            itr->second->SendPacket(sharedPacket.Get());
             foundPlayerToSend = true;
         }
     }
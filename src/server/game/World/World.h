@@ -70,6 +70,7 @@ enum WorldTimers
     WUPDATE_PINGDB,
     WUPDATE_5_SECS,
     WUPDATE_WHO_LIST,
+    WUPDATE_OBJECT_POOL_TRIM,
     WUPDATE_COUNT
 };
 
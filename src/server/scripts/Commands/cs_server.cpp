@@ -29,6 +29,7 @@
 #include "Language.h"
 #include "ModuleMgr.h"
 #include "MySQLThreading.h"
+#include "ObjectPool.h"
 #include "Player.h"
 #include "Realm.h"
 #include "ScriptMgr.h"
@@ -91,6 +92,7 @@ public:
             { "idlerestart",  serverIdleRestartCommandTable },
             { "idleshutdown", serverIdleShutdownCommandTable },
             { "info",         HandleServerInfoCommand,           SEC_PLAYER,        Console::Yes },
+            { "memory",       HandleServerMemoryCommand,         SEC_ADMINISTRATOR, Console::Yes },
             { "motd",         HandleServerMotdCommand,           SEC_PLAYER,        Console::Yes },
             { "restart",      serverRestartCommandTable },
             { "shutdown",     serverShutdownCommandTable },
@@ -255,6 +257,15 @@ public:
 
         return true;
     }
+    // Display allocation statistics of the object pools
+    static bool HandleServerMemoryCommand(ChatHandler* handler)
+    {
+        for (ObjectPool::Statistics const& pool : ObjectPool::GetAllStatistics())
+            handler->SendSysMessage(Acore::StringFormatFmt("{}: {} in use, {} allocations, {} KB reserved", pool.Name, pool.InUse, pool.Allocations, pool.ReservedBytes / 1024));
+
+        return true;
+    }
+
     // Display the 'Message of the day' for the realm
     static bool HandleServerMotdCommand(ChatHandler* handler)
     {
@@ -17,6 +17,7 @@
 
 #include "DBCStore.h"
 #include "DBCDatabaseLoader.h"
+#include "DBCFileLoader.h"
 
 DBCStorageBase::DBCStorageBase(char const* fmt) : _fieldCount(0), _fileFormat(fmt), _dataTable(nullptr), _indexTableSize(0)
 {
@@ -41,6 +42,11 @@ bool DBCStorageBase::Load(char const* path, char**& indexTable)
 
     _fieldCount = dbc.GetCols();
 
+    // mappable formats have no strings, so the index table is all that needs to be built
+    _fileMapping = dbc.AutoProduceMappedData(_fileFormat, _indexTableSize, indexTable);
+    if (_fileMapping)
+        return indexTable != nullptr;
+
     // load raw non-string data
     _dataTable = dbc.AutoProduceData(_fileFormat, _indexTableSize, indexTable);
 
@@ -58,6 +64,10 @@ bool DBCStorageBase::LoadStringsFrom(char const* path, char** indexTable)
     if (!indexTable)
         return false;
 
+    // no strings to localize in a mapped store
+    if (_fileMapping)
+        return true;
+
     DBCFileLoader dbc;
 
     // Check if load was successful, only then continue
@@ -22,8 +22,11 @@
 #include "DBCStorageIterator.h"
 #include "Errors.h"
 #include <cstring>
+#include <memory>
 #include <vector>
 
+class DBCFileMapping;
+
 /// Interface class for common access
 class DBCStorageBase
 {
@@ -46,6 +49,7 @@ protected:
     uint32 _fieldCount;
     char const* _fileFormat;
     char* _dataTable;
+    std::unique_ptr<DBCFileMapping> _fileMapping;           // records used in place when the file layout matches the structure
     std::vector<char*> _stringPool;
     uint32 _indexTableSize;
 };
@@ -0,0 +1,406 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EventMap.h"
+#include "gtest/gtest.h"
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // The std::multimap based EventMap this class replaced, kept as the reference for the differential test
+    class MultimapEventMap
+    {
+        typedef std::multimap<uint32, uint32> EventStore;
+
+    public:
+        void Update(uint32 time) { _time += time; }
+        [[nodiscard]] uint32 GetTimer() const { return _time; }
+        [[nodiscard]] bool Empty() const { return _eventMap.empty(); }
+
+        void SetPhase(uint8 phase)
+        {
+            if (!phase)
+                _phase = 0;
+            else if (phase <= 8)
+                _phase = (1 << (phase - 1));
+        }
+
+        void AddPhase(uint8 phase)
+        {
+            if (phase && phase <= 8)
+                _phase |= (1 << (phase - 1));
+        }
+
+        void RemovePhase(uint8 phase)
+        {
+            if (phase && phase <= 8)
+                _phase &= ~(1 << (phase - 1));
+        }
+
+        void ScheduleEvent(uint32 eventId, uint32 time, uint32 group = 0, uint32 phase = 0)
+        {
+            if (group && group <= 8)
+                eventId |= (1 << (group + 15));
+
+            if (phase && phase <= 8)
+                eventId |= (1 << (phase + 23));
+
+            _eventMap.emplace(_time + time, eventId);
+        }
+
+        void RescheduleEvent(uint32 eventId, uint32 time, uint32 group = 0, uint32 phase = 0)
+        {
+            CancelEvent(eventId);
+            ScheduleEvent(eventId, time, group, phase);
+        }
+
+        void RepeatEvent(uint32 time) { _eventMap.emplace(_time + time, _lastEvent); }
+
+        uint32 ExecuteEvent()
+        {
+            while (!Empty())
+            {
+                auto const& itr = _eventMap.begin();
+
+                if (itr->first > _time)
+                    return 0;
+                else if (_phase && (itr->second & 0xFF000000) && !((itr->second >> 24) & _phase))
+                    _eventMap.erase(itr);
+                else
+                {
+                    uint32 eventId = (itr->second & 0x0000FFFF);
+                    _lastEvent = itr->second;
+                    _eventMap.erase(itr);
+                    return eventId;
+                }
+            }
+
+            return 0;
+        }
+
+        void DelayEvents(uint32 delay) { _time = delay < _time ? _time - delay : 0; }
+
+        void DelayEvents(uint32 delay, uint32 group)
+        {
+            if (group > 8 || Empty())
+                return;
+
+            EventStore delayed;
+            for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
+            {
+                if (!group || (itr->second & (1 << (group + 15))))
+                {
+                    delayed.insert(EventStore::value_type(itr->first + delay, itr->second));
+                    itr = _eventMap.erase(itr);
+                    continue;
+                }
+
+                ++itr;
+            }
+
+            _eventMap.insert(delayed.begin(), delayed.end());
+        }
+
+        void DelayEventsToMax(uint32 delay, uint32 group)
+        {
+            for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+            {
+                if (itr->first < _time + delay && (group == 0 || ((1 << (group + 15)) & itr->second)))
+                {
+                    ScheduleEvent(itr->second, delay);
+                    _eventMap.erase(itr);
+                    itr = _eventMap.begin();
+                    continue;
+                }
+
+                ++itr;
+            }
+        }
+
+        void CancelEvent(uint32 eventId)
+        {
+            for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+            {
+                if (eventId == (itr->second & 0x0000FFFF))
+                {
+                    itr = _eventMap.erase(itr);
+                    continue;
+                }
+
+                ++itr;
+            }
+        }
+
+        void CancelEventGroup(uint32 group)
+        {
+            if (!group || group > 8)
+                return;
+
+            uint32 groupMask = (1 << (group + 15));
+            for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
+            {
+                if (itr->second & groupMask)
+                {
+                    _eventMap.erase(itr);
+                    itr = _eventMap.begin();
+                    continue;
+                }
+
+                ++itr;
+            }
+        }
+
+        [[nodiscard]] uint32 GetNextEventTime(uint32 eventId) const
+        {
+            for (auto const& itr : _eventMap)
+                if (eventId == (itr.second & 0x0000FFFF))
+                    return itr.first;
+
+            return 0;
+        }
+
+        [[nodiscard]] uint32 GetNextEventTime() const { return Empty() ? 0 : _eventMap.begin()->first; }
+
+        [[nodiscard]] Milliseconds GetTimeUntilEvent(uint32 eventId) const
+        {
+            for (std::pair<uint32 const, uint32> const& itr : _eventMap)
+                if (eventId == (itr.second & 0x0000FFFF))
+                    return std::chrono::duration_cast<Milliseconds>(Milliseconds(itr.first) - Milliseconds(_time));
+
+            return Milliseconds::max();
+        }
+
+    private:
+        uint32 _time{0};
+        uint32 _phase{0};
+        uint32 _lastEvent{0};
+        EventStore _eventMap;
+    };
+
+    std::vector<uint32> ExecuteAll(EventMap& events)
+    {
+        std::vector<uint32> executed;
+        while (uint32 eventId = events.ExecuteEvent())
+            executed.push_back(eventId);
+
+        return executed;
+    }
+}
+
+TEST(EventMapTest, ExecutesInTimeOrder)
+{
+    EventMap events;
+    events.ScheduleEvent(3, 300ms);
+    events.ScheduleEvent(1, 100ms);
+    events.ScheduleEvent(2, 200ms);
+    EXPECT_EQ(events.GetNextEventTime(), 100u);
+
+    events.Update(99);
+    EXPECT_EQ(events.ExecuteEvent(), 0u);
+
+    events.Update(201);
+    EXPECT_EQ(ExecuteAll(events), (std::vector<uint32>{ 1, 2, 3 }));
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, SameTimeRunsInSchedulingOrder)
+{
+    EventMap events;
+    for (uint32 eventId = 1; eventId <= 20; ++eventId)
+        events.ScheduleEvent(eventId, Milliseconds(eventId % 2 ? 50 : 100));
+
+    events.Update(100);
+    EXPECT_EQ(ExecuteAll(events), (std::vector<uint32>{ 1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20 }));
+}
+
+TEST(EventMapTest, Repeat)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 100ms, 2, 0);
+    events.ScheduleEvent(2, 150ms);
+
+    events.Update(100);
+    EXPECT_EQ(events.ExecuteEvent(), 1u);
+    events.Repeat(50ms);
+
+    // the repeat runs after the event already scheduled for the same time and keeps its group
+    events.Update(50);
+    EXPECT_EQ(ExecuteAll(events), (std::vector<uint32>{ 2, 1 }));
+
+    events.Repeat(10ms);
+    events.CancelEventGroup(2);
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, Phases)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 100ms, 0, 1);
+    events.ScheduleEvent(2, 100ms, 0, 2);
+    events.ScheduleEvent(3, 100ms);
+    events.SetPhase(2);
+    EXPECT_TRUE(events.IsInPhase(2));
+    EXPECT_FALSE(events.IsInPhase(1));
+
+    // events of other phases are dropped once due
+    events.Update(100);
+    EXPECT_EQ(ExecuteAll(events), (std::vector<uint32>{ 2, 3 }));
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, CancelAndReschedule)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 100ms);
+    events.ScheduleEvent(1, 200ms);
+    events.ScheduleEvent(2, 150ms, 3);
+    events.ScheduleEvent(3, 250ms, 3);
+
+    events.RescheduleEvent(1, 300ms);
+    EXPECT_EQ(events.GetNextEventTime(1), 300u);
+
+    events.CancelEventGroup(3);
+    EXPECT_EQ(events.GetNextEventTime(2), 0u);
+    EXPECT_EQ(events.GetTimeUntilEvent(3), Milliseconds::max());
+
+    events.CancelEvent(1);
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, Delays)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 100ms, 1);
+    events.ScheduleEvent(2, 100ms, 2);
+    events.ScheduleEvent(3, 500ms, 1);
+
+    events.DelayEvents(50, 1);
+    EXPECT_EQ(events.GetNextEventTime(1), 150u);
+    EXPECT_EQ(events.GetNextEventTime(2), 100u);
+    EXPECT_EQ(events.GetNextEventTime(3), 550u);
+
+    events.DelayEventsToMax(200, 0);
+    EXPECT_EQ(events.GetTimeUntilEvent(1), 200ms);
+    EXPECT_EQ(events.GetTimeUntilEvent(2), 200ms);
+    EXPECT_EQ(events.GetTimeUntilEvent(3), 550ms);
+
+    events.Update(100);
+    events.DelayEvents(60ms);
+    EXPECT_EQ(events.GetTimer(), 40u);
+    events.DelayEvents(1000ms);
+    EXPECT_EQ(events.GetTimer(), 0u);
+}
+
+TEST(EventMapTest, MatchesMultimapImplementation)
+{
+    std::mt19937 rng(20260418);
+    auto roll = [&rng](uint32 max) { return std::uniform_int_distribution<uint32>(0, max)(rng); };
+
+    for (uint32 run = 0; run < 200; ++run)
+    {
+        EventMap events;
+        MultimapEventMap reference;
+
+        for (uint32 step = 0; step < 3000; ++step)
+        {
+            uint32 const eventId = roll(11) + 1;
+            uint32 const group = roll(9);
+            uint32 const phase = roll(9);
+            uint32 const time = roll(4) * 50;
+
+            switch (roll(15))
+            {
+                case 0:
+                case 1:
+                case 2:
+                    events.ScheduleEvent(eventId, time, group, phase);
+                    reference.ScheduleEvent(eventId, time, group, phase);
+                    break;
+                case 3:
+                    events.RescheduleEvent(eventId, time, group, phase);
+                    reference.RescheduleEvent(eventId, time, group, phase);
+                    break;
+                case 4:
+                    events.RepeatEvent(time);
+                    reference.RepeatEvent(time);
+                    break;
+                case 5:
+                case 6:
+                case 7:
+                    events.Update(time);
+                    reference.Update(time);
+                    break;
+                case 8:
+                case 9:
+                    ASSERT_EQ(events.ExecuteEvent(), reference.ExecuteEvent()) << "run " << run << " step " << step;
+                    break;
+                case 10:
+                    events.DelayEvents(time, group);
+                    reference.DelayEvents(time, group);
+                    break;
+                case 11:
+                    events.DelayEventsToMax(time, group);
+                    reference.DelayEventsToMax(time, group);
+                    break;
+                case 12:
+                    events.CancelEvent(eventId);
+                    reference.CancelEvent(eventId);
+                    break;
+                case 13:
+                    events.CancelEventGroup(group);
+                    reference.CancelEventGroup(group);
+                    break;
+                case 14:
+                    events.DelayEvents(time);
+                    reference.DelayEvents(time);
+                    break;
+                case 15:
+                    switch (roll(2))
+                    {
+                        case 0:
+                            events.SetPhase(phase);
+                            reference.SetPhase(phase);
+                            break;
+                        case 1:
+                            events.AddPhase(phase);
+                            reference.AddPhase(phase);
+                            break;
+                        default:
+                            events.RemovePhase(phase);
+                            reference.RemovePhase(phase);
+                            break;
+                    }
+                    break;
+            }
+
+            ASSERT_EQ(events.Empty(), reference.Empty()) << "run " << run << " step " << step;
+            ASSERT_EQ(events.GetTimer(), reference.GetTimer()) << "run " << run << " step " << step;
+            ASSERT_EQ(events.GetNextEventTime(), reference.GetNextEventTime()) << "run " << run << " step " << step;
+            ASSERT_EQ(events.GetNextEventTime(eventId), reference.GetNextEventTime(eventId)) << "run " << run << " step " << step;
+            ASSERT_EQ(events.GetTimeUntilEvent(eventId), reference.GetTimeUntilEvent(eventId)) << "run " << run << " step " << step;
+        }
+
+        // drain both, the remaining order has to match as well
+        events.Update(100000);
+        reference.Update(100000);
+        while (!reference.Empty())
+            ASSERT_EQ(events.ExecuteEvent(), reference.ExecuteEvent()) << "run " << run;
+        EXPECT_TRUE(events.Empty());
+    }
+}
@@ -0,0 +1,264 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EventProcessor.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    std::vector<uint32> Sorted(std::vector<uint32> ids)
+    {
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+
+    struct EventLog
+    {
+        std::vector<uint32> Executed;
+        std::vector<uint32> Aborted;
+        std::vector<uint32> Deleted;
+    };
+
+    class RecordingEvent : public BasicEvent
+    {
+    public:
+        RecordingEvent(EventLog& log, uint32 id) : _log(log), _id(id) { }
+        ~RecordingEvent() override { _log.Deleted.push_back(_id); }
+
+        bool Execute(uint64 /*e_time*/, uint32 /*p_time*/) override
+        {
+            _log.Executed.push_back(_id);
+            return true;
+        }
+
+        bool IsDeletable() const override { return Deletable; }
+        void Abort(uint64 /*e_time*/) override { _log.Aborted.push_back(_id); }
+
+        bool Deletable = true;
+
+    private:
+        EventLog& _log;
+        uint32 _id;
+    };
+
+    // re-adds itself until it ran the requested number of times
+    class RepeatingEvent : public BasicEvent
+    {
+    public:
+        RepeatingEvent(EventProcessor& events, EventLog& log, uint32 id, uint32 repeats) : _events(events), _log(log), _id(id), _repeats(repeats) { }
+
+        bool Execute(uint64 e_time, uint32 /*p_time*/) override
+        {
+            _log.Executed.push_back(_id);
+            if (!--_repeats)
+                return true;
+
+            _events.AddEvent(this, e_time + 100);
+            return false;
+        }
+
+    private:
+        EventProcessor& _events;
+        EventLog& _log;
+        uint32 _id;
+        uint32 _repeats;
+    };
+}
+
+TEST(EventProcessorTest, ExecutesInTimeOrder)
+{
+    EventLog log;
+    EventProcessor events;
+
+    events.AddEventAtOffset(new RecordingEvent(log, 3), 300ms);
+    events.AddEventAtOffset(new RecordingEvent(log, 1), 100ms);
+    events.AddEventAtOffset(new RecordingEvent(log, 4), 400ms);
+    events.AddEventAtOffset(new RecordingEvent(log, 2), 200ms);
+    EXPECT_EQ(events.GetNextEventTime(), 100u);
+
+    events.Update(99);
+    EXPECT_TRUE(log.Executed.empty());
+
+    events.Update(151);
+    EXPECT_EQ(log.Executed, (std::vector<uint32>{ 1, 2 }));
+    EXPECT_EQ(log.Deleted, (std::vector<uint32>{ 1, 2 }));
+    EXPECT_EQ(events.GetNextEventTime(), 300u);
+
+    events.Update(1000);
+    EXPECT_EQ(log.Executed, (std::vector<uint32>{ 1, 2, 3, 4 }));
+    EXPECT_EQ(events.GetNextEventTime(), 0u);
+}
+
+TEST(EventProcessorTest, SameTimeRunsInInsertionOrder)
+{
+    EventLog log;
+    EventProcessor events;
+
+    for (uint32 id = 0; id < 20; ++id)
+        events.AddEventAtOffset(new RecordingEvent(log, id), Milliseconds(id % 2 ? 50 : 100));
+
+    events.Update(100);
+    EXPECT_EQ(log.Executed, (std::vector<uint32>{ 1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18 }));
+}
+
+TEST(EventProcessorTest, EventReschedulesItself)
+{
+    EventLog log;
+    EventProcessor events;
+
+    events.AddEventAtOffset(new RepeatingEvent(events, log, 1, 3), 100ms);
+    events.AddEventAtOffset(new RecordingEvent(log, 2), 250ms);
+
+    events.Update(100);
+    EXPECT_EQ(events.GetNextEventTime(), 200u);
+    events.Update(100);
+    events.Update(100);
+    events.Update(100);
+    EXPECT_EQ(log.Executed, (std::vector<uint32>{ 1, 1, 2, 1 }));
+    EXPECT_EQ(events.GetNextEventTime(), 0u);
+}
+
+TEST(EventProcessorTest, ModifyEventTime)
+{
+    EventLog log;
+    EventProcessor events;
+
+    RecordingEvent* late = new RecordingEvent(log, 1);
+    events.AddEventAtOffset(late, 500ms);
+    events.AddEventAtOffset(new RecordingEvent(log, 2), 100ms);
+    events.AddEventAtOffset(new RecordingEvent(log, 3), 100ms);
+
+    // moved to a time that is already taken it runs after the events scheduled there before
+    events.ModifyEventTime(late, 100ms);
+    events.Update(100);
+    EXPECT_EQ(log.Executed, (std::vector<uint32>{ 2, 3, 1 }));
+
+    RecordingEvent* early = new RecordingEvent(log, 4);
+    events.AddEventAtOffset(early, 50ms);
+    events.AddEventAtOffset(new RecordingEvent(log, 5), 100ms);
+    events.ModifyEventTime(early, Milliseconds(events.CalculateTime(200)));
+    events.Update(100);
+    EXPECT_EQ(log.Executed, (std::vector<uint32>{ 2, 3, 1, 5 }));
+    events.Update(100);
+    EXPECT_EQ(log.Executed, (std::vector<uint32>{ 2, 3, 1, 5, 4 }));
+}
+
+TEST(EventProcessorTest, ScheduledAbort)
+{
+    EventLog log;
+    EventProcessor events;
+
+    RecordingEvent* aborted = new RecordingEvent(log, 1);
+    events.AddEventAtOffset(aborted, 100ms);
+    events.AddEventAtOffset(new RecordingEvent(log, 2), 100ms);
+    aborted->ScheduleAbort();
+
+    events.Update(100);
+    EXPECT_EQ(log.Executed, (std::vector<uint32>{ 2 }));
+    EXPECT_EQ(log.Aborted, (std::vector<uint32>{ 1 }));
+    EXPECT_EQ(log.Deleted, (std::vector<uint32>{ 1, 2 }));
+}
+
+TEST(EventProcessorTest, NonDeletableAbortIsRetriedNextTick)
+{
+    EventLog log;
+    EventProcessor events;
+
+    RecordingEvent* event = new RecordingEvent(log, 1);
+    event->Deletable = false;
+    events.AddEventAtOffset(event, 100ms);
+    event->ScheduleAbort();
+
+    events.Update(100);
+    EXPECT_EQ(log.Aborted, (std::vector<uint32>{ 1 }));
+    EXPECT_TRUE(log.Deleted.empty());
+    EXPECT_EQ(events.GetNextEventTime(), 101u);
+
+    events.Update(1);
+    EXPECT_TRUE(log.Deleted.empty());
+
+    event->Deletable = true;
+    events.Update(1);
+    EXPECT_TRUE(log.Executed.empty());
+    EXPECT_EQ(log.Aborted, (std::vector<uint32>{ 1 }));
+    EXPECT_EQ(log.Deleted, (std::vector<uint32>{ 1 }));
+}
+
+TEST(EventProcessorTest, CancelEventGroup)
+{
+    EventLog log;
+    EventProcessor events;
+
+    events.AddEvent(new RecordingEvent(log, 1), events.CalculateTime(100), true, 1);
+    events.AddEvent(new RecordingEvent(log, 2), events.CalculateTime(200), true, 2);
+    events.AddEvent(new RecordingEvent(log, 3), events.CalculateTime(50), true, 1);
+    events.AddEvent(new RecordingEvent(log, 4), events.CalculateTime(300), true, 2);
+
+    // cancelled events are aborted in heap order
+    events.CancelEventGroup(1);
+    EXPECT_EQ(Sorted(log.Aborted), (std::vector<uint32>{ 1, 3 }));
+    EXPECT_EQ(Sorted(log.Deleted), (std::vector<uint32>{ 1, 3 }));
+    EXPECT_EQ(events.GetNextEventTime(), 200u);
+
+    events.Update(300);
+    EXPECT_EQ(log.Executed, (std::vector<uint32>{ 2, 4 }));
+}
+
+TEST(EventProcessorTest, KillAllEvents)
+{
+    EventLog log;
+    EventProcessor events;
+
+    RecordingEvent* kept = new RecordingEvent(log, 2);
+    kept->Deletable = false;
+    events.AddEventAtOffset(new RecordingEvent(log, 1), 100ms);
+    events.AddEventAtOffset(kept, 200ms);
+    events.AddEventAtOffset(new RecordingEvent(log, 3), 300ms);
+
+    events.KillAllEvents(false);
+    EXPECT_EQ(Sorted(log.Aborted), (std::vector<uint32>{ 1, 2, 3 }));
+    EXPECT_EQ(Sorted(log.Deleted), (std::vector<uint32>{ 1, 3 }));
+    EXPECT_EQ(events.GetNextEventTime(), 200u);
+
+    // aborted events never execute
+    events.Update(200);
+    EXPECT_TRUE(log.Executed.empty());
+    EXPECT_EQ(log.Deleted.size(), 2u);
+    EXPECT_EQ(events.GetNextEventTime(), 201u);
+
+    events.KillAllEvents(true);
+    EXPECT_EQ(log.Aborted.size(), 3u);
+    EXPECT_EQ(Sorted(log.Deleted), (std::vector<uint32>{ 1, 2, 3 }));
+    EXPECT_EQ(events.GetNextEventTime(), 0u);
+}
+
+TEST(EventProcessorTest, DestructorDeletesPendingEvents)
+{
+    EventLog log;
+    {
+        EventProcessor events;
+        events.AddEventAtOffset(new RecordingEvent(log, 1), 100ms);
+        events.AddEventAtOffset([&log]() { log.Executed.push_back(2); }, 50ms);
+        events.Update(50);
+    }
+
+    EXPECT_EQ(log.Executed, (std::vector<uint32>{ 2 }));
+    EXPECT_EQ(log.Aborted, (std::vector<uint32>{ 1 }));
+    EXPECT_EQ(log.Deleted, (std::vector<uint32>{ 1 }));
+}
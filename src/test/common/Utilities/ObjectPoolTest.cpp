@@ -0,0 +1,211 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectPool.h"
+#include "gtest/gtest.h"
+#include <memory>
+#include <thread>
+
+namespace
+{
+    struct PooledBase
+    {
+        virtual ~PooledBase() = default;
+
+        OBJECT_POOL_ALLOCATED("ObjectPoolTest.Pooled")
+
+        uint32 Value = 0;
+    };
+
+    struct PooledDerived : PooledBase
+    {
+        char Payload[500] = { };
+    };
+
+    // frees a pooled object while the thread it runs on is being torn down
+    struct FreeOnThreadExit
+    {
+        ~FreeOnThreadExit() { delete Object; }
+
+        PooledBase* Object = nullptr;
+    };
+}
+
+TEST(ObjectPoolTest, GetReturnsSamePool)
+{
+    EXPECT_EQ(&ObjectPool::Get("ObjectPoolTest.Named"), &ObjectPool::Get("ObjectPoolTest.Named"));
+    EXPECT_NE(&ObjectPool::Get("ObjectPoolTest.Named"), &ObjectPool::Get("ObjectPoolTest.Other"));
+}
+
+TEST(ObjectPoolTest, ReusesFreedBlocks)
+{
+    ObjectPool& pool = ObjectPool::Get("ObjectPoolTest.Reuse");
+
+    void* first = pool.Allocate(100);
+    pool.Deallocate(first, 100);
+    void* second = pool.Allocate(120);
+    EXPECT_EQ(first, second);
+
+    // a different bucket never hands out the same block
+    void* other = pool.Allocate(200);
+    EXPECT_NE(second, other);
+
+    pool.Deallocate(second, 120);
+    pool.Deallocate(other, 200);
+}
+
+TEST(ObjectPoolTest, Statistics)
+{
+    ObjectPool& pool = ObjectPool::Get("ObjectPoolTest.Statistics");
+
+    void* small = pool.Allocate(64);
+    void* large = pool.Allocate(ObjectPool::MAX_BLOCK_SIZE + 1);
+
+    ObjectPool::Statistics statistics = pool.GetStatistics();
+    EXPECT_EQ(statistics.Name, "ObjectPoolTest.Statistics");
+    EXPECT_EQ(statistics.Allocations, 2u);
+    EXPECT_EQ(statistics.InUse, 2u);
+    EXPECT_GT(statistics.ReservedBytes, 0u);
+
+    pool.Deallocate(small, 64);
+    pool.Deallocate(large, ObjectPool::MAX_BLOCK_SIZE + 1);
+    pool.Deallocate(nullptr, 64);
+
+    statistics = pool.GetStatistics();
+    EXPECT_EQ(statistics.Allocations, 2u);
+    EXPECT_EQ(statistics.InUse, 0u);
+}
+
+TEST(ObjectPoolTest, ClassLevelOperators)
+{
+    ObjectPool& pool = ObjectPool::Get("ObjectPoolTest.Pooled");
+    uint64 const inUse = pool.GetStatistics().InUse;
+
+    PooledBase* base = new PooledBase();
+    PooledBase* derived = new PooledDerived();
+    EXPECT_EQ(pool.GetStatistics().InUse, inUse + 2);
+
+    // the sized delete sends the derived object back to its own larger bucket
+    delete derived;
+    delete base;
+    EXPECT_EQ(pool.GetStatistics().InUse, inUse);
+
+    PooledBase* reused = new PooledBase();
+    EXPECT_EQ(reused, base);
+    delete reused;
+}
+
+TEST(ObjectPoolTest, FreedOnAnotherThread)
+{
+    ObjectPool& pool = ObjectPool::Get("ObjectPoolTest.CrossThread");
+
+    std::vector<void*> blocks;
+    for (uint32 i = 0; i < 1000; ++i)
+        blocks.push_back(pool.Allocate(300));
+
+    std::thread([&pool, &blocks]()
+    {
+        for (void* block : blocks)
+            pool.Deallocate(block, 300);
+    }).join();
+
+    EXPECT_EQ(pool.GetStatistics().InUse, 0u);
+
+    // the exiting thread handed its cache back, so no new memory is needed
+    uint64 const reserved = pool.GetStatistics().ReservedBytes;
+    for (void*& block : blocks)
+        block = pool.Allocate(300);
+    EXPECT_EQ(pool.GetStatistics().ReservedBytes, reserved);
+
+    for (void* block : blocks)
+        pool.Deallocate(block, 300);
+}
+
+TEST(ObjectPoolTest, FreedAfterThreadCacheTornDown)
+{
+    ObjectPool& pool = ObjectPool::Get("ObjectPoolTest.Pooled");
+    uint64 const inUse = pool.GetStatistics().InUse;
+
+    std::thread([]()
+    {
+        // constructed before the pool's thread cache, so destroyed after it
+        static thread_local FreeOnThreadExit freeOnExit;
+        freeOnExit.Object = new PooledDerived();
+        freeOnExit.Object->Value = 42;
+    }).join();
+
+    EXPECT_EQ(pool.GetStatistics().InUse, inUse);
+}
+
+TEST(ObjectPoolTest, TrimReleasesFreeSlabs)
+{
+    ObjectPool& pool = ObjectPool::Get("ObjectPoolTest.Trim");
+
+    // allocated and freed on threads that exit, so every block ends in the shared lists
+    std::vector<void*> blocks;
+    std::thread([&pool, &blocks]()
+    {
+        for (uint32 i = 0; i < 2000; ++i)
+            blocks.push_back(pool.Allocate(300));
+    }).join();
+
+    // nothing is completely free yet
+    uint64 const reserved = pool.GetStatistics().ReservedBytes;
+    EXPECT_EQ(pool.Trim(0), 0u);
+
+    std::thread([&pool, &blocks]()
+    {
+        for (void* block : blocks)
+            pool.Deallocate(block, 300);
+    }).join();
+
+    // the free memory is below the limit
+    EXPECT_EQ(pool.Trim(reserved), 0u);
+    EXPECT_EQ(pool.GetStatistics().ReservedBytes, reserved);
+
+    std::size_t const released = pool.Trim(0);
+    EXPECT_EQ(released, reserved);
+    EXPECT_EQ(pool.GetStatistics().ReservedBytes, 0u);
+
+    // still usable afterwards
+    void* block = pool.Allocate(300);
+    EXPECT_GT(pool.GetStatistics().ReservedBytes, 0u);
+    pool.Deallocate(block, 300);
+}
+
+TEST(ObjectPoolTest, TrimKeepsPartlyUsedSlabs)
+{
+    ObjectPool& pool = ObjectPool::Get("ObjectPoolTest.TrimPartlyUsed");
+
+    std::vector<void*> blocks;
+    for (uint32 i = 0; i < 2000; ++i)
+        blocks.push_back(pool.Allocate(1000));
+
+    // every other block stays in use, so no slab is completely free
+    std::thread([&pool, &blocks]()
+    {
+        for (std::size_t i = 0; i < blocks.size(); i += 2)
+            pool.Deallocate(blocks[i], 1000);
+    }).join();
+
+    uint64 const reserved = pool.GetStatistics().ReservedBytes;
+    EXPECT_EQ(pool.Trim(0), 0u);
+    EXPECT_EQ(pool.GetStatistics().ReservedBytes, reserved);
+
+    for (std::size_t i = 1; i < blocks.size(); i += 2)
+        pool.Deallocate(blocks[i], 1000);
+}
@@ -0,0 +1,140 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TaskScheduler.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST(TaskSchedulerTest, RunsInEndOrder)
+{
+    TaskScheduler scheduler;
+    std::vector<uint32> executed;
+
+    scheduler.Schedule(300ms, [&executed](TaskContext) { executed.push_back(3); });
+    scheduler.Schedule(100ms, [&executed](TaskContext) { executed.push_back(1); });
+    scheduler.Schedule(200ms, [&executed](TaskContext) { executed.push_back(2); });
+    scheduler.Schedule(100ms, [&executed](TaskContext) { executed.push_back(4); });
+
+    scheduler.Update(99ms);
+    EXPECT_TRUE(executed.empty());
+
+    scheduler.Update(1000ms);
+    EXPECT_EQ(executed, (std::vector<uint32>{ 1, 4, 2, 3 }));
+}
+
+TEST(TaskSchedulerTest, Repeat)
+{
+    TaskScheduler scheduler;
+    std::vector<uint32> counters;
+
+    scheduler.Schedule(100ms, [&counters](TaskContext context)
+    {
+        counters.push_back(context.GetRepeatCounter());
+        if (context.GetRepeatCounter() < 3)
+            context.Repeat();
+    });
+
+    // repeats are timed from the planned end, a late update runs them all at once
+    scheduler.Update(100ms);
+    EXPECT_EQ(counters, (std::vector<uint32>{ 0 }));
+    scheduler.Update(350ms);
+    EXPECT_EQ(counters, (std::vector<uint32>{ 0, 1, 2, 3 }));
+}
+
+TEST(TaskSchedulerTest, CancelAndDelayGroup)
+{
+    TaskScheduler scheduler;
+    std::vector<uint32> executed;
+
+    scheduler.Schedule(100ms, 1, [&executed](TaskContext) { executed.push_back(1); });
+    scheduler.Schedule(100ms, 2, [&executed](TaskContext) { executed.push_back(2); });
+    scheduler.Schedule(100ms, 3, [&executed](TaskContext) { executed.push_back(3); });
+
+    scheduler.CancelGroup(2);
+    EXPECT_FALSE(scheduler.IsGroupScheduled(2));
+    scheduler.DelayGroup(1, 50ms);
+
+    scheduler.Update(100ms);
+    EXPECT_EQ(executed, (std::vector<uint32>{ 3 }));
+    scheduler.Update(50ms);
+    EXPECT_EQ(executed, (std::vector<uint32>{ 3, 1 }));
+}
+
+TEST(TaskSchedulerTest, RepeatFromStaleContextIsRejected)
+{
+    EXPECT_DEATH(
+    {
+        TaskScheduler scheduler;
+        TaskContext kept;
+
+        scheduler.Schedule(100ms, [&kept](TaskContext context)
+        {
+            if (!context.GetRepeatCounter())
+            {
+                kept = context;
+                context.Repeat();
+                return;
+            }
+
+            // the first invocation already repeated the task, this one owns it now
+            kept.Repeat();
+        });
+
+        scheduler.Update(200ms);
+    }, "");
+}
+
+TEST(TaskSchedulerTest, RepeatTwiceFromOneInvocationIsRejected)
+{
+    EXPECT_DEATH(
+    {
+        TaskScheduler scheduler;
+        scheduler.Schedule(100ms, [](TaskContext context)
+        {
+            TaskContext copy = context;
+            context.Repeat();
+            copy.Repeat();
+        });
+        scheduler.Update(100ms);
+    }, "");
+}
+
+TEST(TaskSchedulerTest, ContextKeptWithoutRepeatMayRepeatLater)
+{
+    TaskScheduler scheduler;
+    TaskContext kept;
+    uint32 executions = 0;
+
+    scheduler.Schedule(100ms, [&kept, &executions](TaskContext context)
+    {
+        ++executions;
+        kept = context;
+    });
+
+    scheduler.Update(100ms);
+    EXPECT_EQ(executions, 1u);
+
+    kept.Repeat(50ms);
+    EXPECT_DEATH(kept.Repeat(50ms), "");
+
+    scheduler.Update(50ms);
+    EXPECT_EQ(executions, 2u);
+    scheduler.Update(1000ms);
+    EXPECT_EQ(executions, 2u);
+}
@@ -0,0 +1,58 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "QueryResult.h"
+#include "MySQLConnection.h"
+#include "MySQLHacks.h"
+#include "gtest/gtest.h"
+#include <cstring>
+
+namespace
+{
+    // never opened, the handle only carries the error a failed row read leaves on it
+    class FailedStreamConnection : public MySQLConnection
+    {
+    public:
+        FailedStreamConnection(MySQLConnectionInfo& connInfo, uint32 errNo, char const* error) : MySQLConnection(connInfo)
+        {
+            m_Mysql = reinterpret_cast<MySQLHandle*>(mysql_init(nullptr));
+            m_Mysql->net.last_errno = errNo;
+            std::strncpy(m_Mysql->net.last_error, error, sizeof(m_Mysql->net.last_error) - 1);
+        }
+
+    protected:
+        void DoPrepareStatements() override { }
+    };
+}
+
+TEST(QueryResultTest, StreamedReadErrorAborts)
+{
+    // the state mysql_fetch_row leaves an unbuffered result in after a failed read: no rows, handle detached
+    auto readFailedRow = []()
+    {
+        MySQLConnectionInfo connInfo("127.0.0.1;3306;acore;acore;acore_world");
+        FailedStreamConnection connection(connInfo, 2013, "Lost connection to MySQL server during query");
+
+        MySQLResult* result = new MySQLResult();
+        result->eof = true;
+
+        ResultSet resultSet(result, nullptr, 0, 0, &connection);
+        resultSet.NextRow();
+    };
+
+    EXPECT_DEATH(readFailedRow(), "Streamed query result ended early, error 2013: Lost connection to MySQL server during query");
+}
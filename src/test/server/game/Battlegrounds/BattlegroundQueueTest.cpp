@@ -0,0 +1,239 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BattlegroundQueue.h"
+#include "gtest/gtest.h"
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr uint32 MaxRatingDifference = 150;
+
+    // the queue owns and deletes the team
+    GroupQueueInfo* AddTeam(BattlegroundQueue& queue, uint8 groupType, uint32 arenaTeamId, uint32 rating, uint32 joinTime, uint32 previousOpponentsTeamId = 0)
+    {
+        GroupQueueInfo* ginfo = new GroupQueueInfo();
+        ginfo->teamId = groupType == BG_QUEUE_PREMADE_HORDE ? TEAM_HORDE : TEAM_ALLIANCE;
+        ginfo->RealTeamID = ginfo->teamId;
+        ginfo->BgTypeId = BATTLEGROUND_AA;
+        ginfo->IsRated = true;
+        ginfo->ArenaType = 2;
+        ginfo->ArenaTeamId = arenaTeamId;
+        ginfo->JoinTime = joinTime;
+        ginfo->RemoveInviteTime = 0;
+        ginfo->IsInvitedToBGInstanceGUID = 0;
+        ginfo->ArenaTeamRating = rating;
+        ginfo->ArenaMatchmakerRating = rating;
+        ginfo->OpponentsTeamRating = 0;
+        ginfo->OpponentsMatchmakerRating = 0;
+        ginfo->PreviousOpponentsTeamId = previousOpponentsTeamId;
+        ginfo->BracketId = BG_BRACKET_ID_FIRST;
+        ginfo->GroupType = groupType;
+        queue.AddGroupToQueue(ginfo);
+        return ginfo;
+    }
+
+    using Match = std::pair<GroupQueueInfo*, GroupQueueInfo*>;
+
+    // runs the multi-match loop of a queue update, inviting every match like InviteGroupToBG does
+    std::vector<Match> StartRatedArenas(BattlegroundQueue& queue, uint32 arenaRating, int32 discardTime = 0, int32 discardOpponentsTime = 0)
+    {
+        std::vector<Match> matches;
+        queue.StartRatedArenas(BG_BRACKET_ID_FIRST, arenaRating, MaxRatingDifference, discardTime, discardOpponentsTime,
+            [&](GroupQueueInfo* aTeam, GroupQueueInfo* hTeam)
+            {
+                matches.emplace_back(aTeam, hTeam);
+                aTeam->IsInvitedToBGInstanceGUID = matches.size();
+                hTeam->IsInvitedToBGInstanceGUID = matches.size();
+                return true;
+            });
+        return matches;
+    }
+}
+
+TEST(BattlegroundQueueTest, PairsBothFactionsInRatingWindow)
+{
+    BattlegroundQueue queue;
+    GroupQueueInfo* alliance = AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 1, 1500, 100);
+    GroupQueueInfo* horde = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 2, 1600, 200);
+    AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 3, 1700, 50);
+
+    GroupQueueInfo* aTeam = nullptr;
+    GroupQueueInfo* hTeam = nullptr;
+    ASSERT_TRUE(queue.FindRatedArenaMatch(BG_BRACKET_ID_FIRST, 1500, MaxRatingDifference, 0, 0, aTeam, hTeam));
+    EXPECT_EQ(aTeam, alliance);
+    EXPECT_EQ(hTeam, horde);
+}
+
+TEST(BattlegroundQueueTest, LongestWaitingTeamInWindowIsChosen)
+{
+    BattlegroundQueue queue;
+    GroupQueueInfo* alliance = AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 1, 1500, 100);
+    AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 2, 1500, 300);
+    GroupQueueInfo* horde = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 3, 1450, 200);
+    AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 4, 1520, 250);
+
+    GroupQueueInfo* aTeam = nullptr;
+    GroupQueueInfo* hTeam = nullptr;
+    ASSERT_TRUE(queue.FindRatedArenaMatch(BG_BRACKET_ID_FIRST, 1500, MaxRatingDifference, 0, 0, aTeam, hTeam));
+    EXPECT_EQ(aTeam, alliance);
+    EXPECT_EQ(hTeam, horde);
+}
+
+TEST(BattlegroundQueueTest, NoMatchOutsideRatingWindow)
+{
+    BattlegroundQueue queue;
+    AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 1, 1500, 100);
+    AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 2, 1500 + MaxRatingDifference + 1, 200);
+
+    GroupQueueInfo* aTeam = nullptr;
+    GroupQueueInfo* hTeam = nullptr;
+    EXPECT_FALSE(queue.FindRatedArenaMatch(BG_BRACKET_ID_FIRST, 1500, MaxRatingDifference, 0, 0, aTeam, hTeam));
+}
+
+TEST(BattlegroundQueueTest, TeamsPastDiscardTimeIgnoreRating)
+{
+    BattlegroundQueue queue;
+    GroupQueueInfo* alliance = AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 1, 1500, 100);
+    GroupQueueInfo* horde = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 2, 3000, 50);
+
+    GroupQueueInfo* aTeam = nullptr;
+    GroupQueueInfo* hTeam = nullptr;
+    EXPECT_FALSE(queue.FindRatedArenaMatch(BG_BRACKET_ID_FIRST, 1500, MaxRatingDifference, 50, 0, aTeam, hTeam));
+
+    ASSERT_TRUE(queue.FindRatedArenaMatch(BG_BRACKET_ID_FIRST, 1500, MaxRatingDifference, 60, 0, aTeam, hTeam));
+    EXPECT_EQ(aTeam, alliance);
+    EXPECT_EQ(hTeam, horde);
+}
+
+TEST(BattlegroundQueueTest, InvitedTeamsAreSkipped)
+{
+    BattlegroundQueue queue;
+    GroupQueueInfo* alliance = AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 1, 1500, 100);
+    GroupQueueInfo* invited = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 2, 1500, 50);
+    GroupQueueInfo* horde = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 3, 1500, 200);
+    invited->IsInvitedToBGInstanceGUID = 1;
+
+    GroupQueueInfo* aTeam = nullptr;
+    GroupQueueInfo* hTeam = nullptr;
+    ASSERT_TRUE(queue.FindRatedArenaMatch(BG_BRACKET_ID_FIRST, 1500, MaxRatingDifference, 60, 0, aTeam, hTeam));
+    EXPECT_EQ(aTeam, alliance);
+    EXPECT_EQ(hTeam, horde);
+}
+
+TEST(BattlegroundQueueTest, PairsWithinOneFactionQueue)
+{
+    BattlegroundQueue queue;
+    GroupQueueInfo* first = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 1, 1500, 100);
+    GroupQueueInfo* second = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 2, 1550, 200);
+
+    GroupQueueInfo* aTeam = nullptr;
+    GroupQueueInfo* hTeam = nullptr;
+    ASSERT_TRUE(queue.FindRatedArenaMatch(BG_BRACKET_ID_FIRST, 1500, MaxRatingDifference, 0, 0, aTeam, hTeam));
+    EXPECT_EQ(aTeam, first);
+    EXPECT_EQ(hTeam, second);
+}
+
+TEST(BattlegroundQueueTest, SameArenaTeamIsNotPaired)
+{
+    BattlegroundQueue queue;
+    AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 1, 1500, 100);
+    AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 1, 1500, 200);
+
+    GroupQueueInfo* aTeam = nullptr;
+    GroupQueueInfo* hTeam = nullptr;
+    EXPECT_FALSE(queue.FindRatedArenaMatch(BG_BRACKET_ID_FIRST, 1500, MaxRatingDifference, 0, 0, aTeam, hTeam));
+}
+
+TEST(BattlegroundQueueTest, PreviousOpponentIsExcludedUntilTimer)
+{
+    BattlegroundQueue queue;
+    GroupQueueInfo* first = AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 1, 1500, 100);
+    GroupQueueInfo* second = AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 2, 1500, 200, 1);
+
+    GroupQueueInfo* aTeam = nullptr;
+    GroupQueueInfo* hTeam = nullptr;
+    EXPECT_FALSE(queue.FindRatedArenaMatch(BG_BRACKET_ID_FIRST, 1500, MaxRatingDifference, 0, 200, aTeam, hTeam));
+
+    ASSERT_TRUE(queue.FindRatedArenaMatch(BG_BRACKET_ID_FIRST, 1500, MaxRatingDifference, 0, 201, aTeam, hTeam));
+    EXPECT_EQ(aTeam, first);
+    EXPECT_EQ(hTeam, second);
+}
+
+TEST(BattlegroundQueueTest, StartsEveryPossibleMatchInOneUpdate)
+{
+    BattlegroundQueue queue;
+    GroupQueueInfo* alliance1 = AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 1, 1500, 100);
+    GroupQueueInfo* horde1 = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 2, 1510, 200);
+    GroupQueueInfo* alliance2 = AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 3, 2000, 300);
+    GroupQueueInfo* horde2 = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 4, 2050, 400);
+    GroupQueueInfo* alone = AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 5, 3000, 500);
+
+    std::vector<Match> matches = StartRatedArenas(queue, 0);
+    ASSERT_EQ(matches.size(), 2u);
+    EXPECT_EQ(matches[0], Match(alliance1, horde1));
+    EXPECT_EQ(matches[1], Match(alliance2, horde2));
+    EXPECT_EQ(alone->IsInvitedToBGInstanceGUID, 0u);
+}
+
+TEST(BattlegroundQueueTest, JoinedTeamRatingIsTriedFirst)
+{
+    BattlegroundQueue queue;
+    GroupQueueInfo* alliance1 = AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 1, 1500, 100);
+    GroupQueueInfo* horde1 = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 2, 1510, 200);
+    GroupQueueInfo* alliance2 = AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 3, 2000, 300);
+    GroupQueueInfo* horde2 = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 4, 2050, 400);
+
+    std::vector<Match> matches = StartRatedArenas(queue, 2050);
+    ASSERT_EQ(matches.size(), 2u);
+    EXPECT_EQ(matches[0], Match(alliance2, horde2));
+    EXPECT_EQ(matches[1], Match(alliance1, horde1));
+}
+
+TEST(BattlegroundQueueTest, SameFactionTeamsPairInJoinOrder)
+{
+    BattlegroundQueue queue;
+    GroupQueueInfo* first = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 1, 1500, 100);
+    GroupQueueInfo* second = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 2, 1500, 200);
+    GroupQueueInfo* third = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 3, 1500, 300);
+    GroupQueueInfo* fourth = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 4, 1500, 400);
+    GroupQueueInfo* fifth = AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 5, 1500, 500);
+
+    std::vector<Match> matches = StartRatedArenas(queue, 0);
+    ASSERT_EQ(matches.size(), 2u);
+    EXPECT_EQ(matches[0], Match(first, second));
+    EXPECT_EQ(matches[1], Match(third, fourth));
+    EXPECT_EQ(fifth->IsInvitedToBGInstanceGUID, 0u);
+}
+
+TEST(BattlegroundQueueTest, StopsWhenArenaCannotBeCreated)
+{
+    BattlegroundQueue queue;
+    AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 1, 1500, 100);
+    AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 2, 1510, 200);
+    AddTeam(queue, BG_QUEUE_PREMADE_ALLIANCE, 3, 2000, 300);
+    AddTeam(queue, BG_QUEUE_PREMADE_HORDE, 4, 2050, 400);
+
+    uint32 calls = 0;
+    queue.StartRatedArenas(BG_BRACKET_ID_FIRST, 0, MaxRatingDifference, 0, 0, [&](GroupQueueInfo*, GroupQueueInfo*)
+    {
+        ++calls;
+        return false;
+    });
+    EXPECT_EQ(calls, 1u);
+}
@@ -0,0 +1,75 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Corpse.h"
+#include "NGrid.h"
+#include "ObjectGridLoader.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    // same visit Map::UnloadIdleGrids runs on a grid out of reach of players
+    bool CanUnload(NGridType& grid)
+    {
+        ObjectGridUnloadChecker worker(grid);
+        TypeContainerVisitor<ObjectGridUnloadChecker, GridTypeMapContainer> gridVisitor(worker);
+        TypeContainerVisitor<ObjectGridUnloadChecker, WorldTypeMapContainer> worldVisitor(worker);
+        grid.VisitAllGrids(gridVisitor);
+        grid.VisitAllGrids(worldVisitor);
+        return worker.CanUnload();
+    }
+}
+
+TEST(ObjectGridUnloadCheckerTest, EmptyGrid)
+{
+    NGridType grid(32 * MAX_NUMBER_OF_GRIDS + 32, 32, 32);
+    EXPECT_TRUE(CanUnload(grid));
+}
+
+TEST(ObjectGridUnloadCheckerTest, BonesKeepGridLoaded)
+{
+    NGridType grid(32 * MAX_NUMBER_OF_GRIDS + 32, 32, 32);
+    Corpse bones(CORPSE_BONES);
+
+    grid.GetGridType(3, 5).AddGridObject(&bones);
+    EXPECT_FALSE(CanUnload(grid));
+
+    bones.RemoveFromGrid();
+    EXPECT_TRUE(CanUnload(grid));
+}
+
+TEST(ObjectGridUnloadCheckerTest, ResurrectableCorpseKeepsGridLoaded)
+{
+    NGridType grid(32 * MAX_NUMBER_OF_GRIDS + 32, 32, 32);
+    Corpse corpse(CORPSE_RESURRECTABLE_PVE);
+
+    grid.GetGridType(MAX_NUMBER_OF_CELLS - 1, 0).AddWorldObject(&corpse);
+    EXPECT_FALSE(CanUnload(grid));
+
+    corpse.RemoveFromGrid();
+    EXPECT_TRUE(CanUnload(grid));
+}
+
+TEST(ObjectGridUnloadCheckerTest, IdleTime)
+{
+    NGridType grid(0, 0, 0);
+    EXPECT_EQ(grid.GetIdleTime(), 0u);
+
+    grid.SetIdleTime(grid.GetIdleTime() + 10 * IN_MILLISECONDS);
+    grid.SetIdleTime(grid.GetIdleTime() + 10 * IN_MILLISECONDS);
+    EXPECT_EQ(grid.GetIdleTime(), 20u * IN_MILLISECONDS);
+}
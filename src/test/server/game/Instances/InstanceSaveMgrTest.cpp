@@ -0,0 +1,46 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "InstanceSaveMgr.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+TEST(InstanceSaveMgrTest, ResetTimeQueueKeepsScheduleOrderForEqualTimes)
+{
+    InstanceSaveMgr::ResetTimeQueue queue;
+    uint64 sequence = 0;
+
+    // maps 1..20 at the same time, with an earlier and a later event around them
+    queue.push({ 200, sequence++, InstanceSaveMgr::InstResetEvent(1, 100, DUNGEON_DIFFICULTY_NORMAL) });
+    for (uint32 mapId = 1; mapId <= 20; ++mapId)
+        queue.push({ 150, sequence++, InstanceSaveMgr::InstResetEvent(1, mapId, DUNGEON_DIFFICULTY_NORMAL) });
+    queue.push({ 100, sequence++, InstanceSaveMgr::InstResetEvent(1, 0, DUNGEON_DIFFICULTY_NORMAL) });
+
+    std::vector<uint32> mapIds;
+    while (!queue.empty())
+    {
+        mapIds.push_back(queue.top().event.mapid);
+        queue.pop();
+    }
+
+    std::vector<uint32> expected = { 0 };
+    for (uint32 mapId = 1; mapId <= 20; ++mapId)
+        expected.push_back(mapId);
+    expected.push_back(100);
+
+    EXPECT_EQ(mapIds, expected);
+}
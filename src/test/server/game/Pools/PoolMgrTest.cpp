@@ -0,0 +1,158 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PoolMgr.h"
+#include "gtest/gtest.h"
+#include <set>
+#include <vector>
+
+namespace
+{
+    constexpr uint32 PoolId = 1;
+
+    // guids 1..size, all of them equal chanced
+    void FillPool(PoolGroup<GameObject>& pool, uint32 size)
+    {
+        pool.SetPoolId(PoolId);
+        for (uint32 guid = 1; guid <= size; ++guid)
+        {
+            PoolObject object(guid, 0.0f);
+            pool.AddEntry(object, size);
+        }
+    }
+
+    std::vector<uint32> Roll(PoolGroup<GameObject>& pool, ActivePoolData const& spawns, uint32 count)
+    {
+        std::vector<PoolObject> rolled;
+        pool.RollEqualChanced(spawns, count, rolled);
+
+        std::vector<uint32> guids;
+        for (PoolObject const& object : rolled)
+            guids.push_back(object.guid);
+        return guids;
+    }
+
+    // every picked guid counted over many rolls, checking each roll picks distinct inactive members
+    std::vector<uint32> CountPicks(PoolGroup<GameObject>& pool, ActivePoolData const& spawns, uint32 size, uint32 count, uint32 rolls)
+    {
+        std::vector<uint32> picks(size + 1, 0);
+        for (uint32 i = 0; i < rolls; ++i)
+        {
+            std::vector<uint32> guids = Roll(pool, spawns, count);
+            EXPECT_EQ(guids.size(), count);
+            EXPECT_EQ(std::set<uint32>(guids.begin(), guids.end()).size(), guids.size());
+            for (uint32 guid : guids)
+            {
+                EXPECT_FALSE(spawns.IsActiveObject<GameObject>(guid));
+                ++picks[guid];
+            }
+        }
+        return picks;
+    }
+}
+
+TEST(PoolMgrTest, RollEqualChancedIsUniform)
+{
+    constexpr uint32 size = 20;
+    constexpr uint32 rolls = 100000;
+
+    PoolGroup<GameObject> pool;
+    FillPool(pool, size);
+    ActivePoolData spawns;
+
+    std::vector<uint32> picks = CountPicks(pool, spawns, size, 1, rolls);
+
+    // 15% is about 11 standard deviations, wide enough to never flake
+    for (uint32 guid = 1; guid <= size; ++guid)
+    {
+        EXPECT_GT(picks[guid], rolls / size * 85 / 100) << "guid " << guid;
+        EXPECT_LT(picks[guid], rolls / size * 115 / 100) << "guid " << guid;
+    }
+}
+
+TEST(PoolMgrTest, RollEqualChancedSkipsActiveMembers)
+{
+    constexpr uint32 size = 20;
+    constexpr uint32 rolls = 50000;
+
+    PoolGroup<GameObject> pool;
+    FillPool(pool, size);
+    ActivePoolData spawns;
+    for (uint32 guid = 1; guid <= size; guid += 4)
+        spawns.ActivateObject<GameObject>(guid, PoolId);
+
+    // 15 inactive members, 2 picked per roll
+    std::vector<uint32> picks = CountPicks(pool, spawns, size, 2, rolls);
+
+    uint32 const expected = rolls * 2 / 15;
+    for (uint32 guid = 1; guid <= size; ++guid)
+    {
+        if (spawns.IsActiveObject<GameObject>(guid))
+            EXPECT_EQ(picks[guid], 0u) << "guid " << guid;
+        else
+        {
+            EXPECT_GT(picks[guid], expected * 85 / 100) << "guid " << guid;
+            EXPECT_LT(picks[guid], expected * 115 / 100) << "guid " << guid;
+        }
+    }
+}
+
+TEST(PoolMgrTest, RollEqualChancedFallbackOnCrowdedPoolIsUniform)
+{
+    constexpr uint32 size = 10;
+    constexpr uint32 rolls = 50000;
+
+    PoolGroup<GameObject> pool;
+    FillPool(pool, size);
+    ActivePoolData spawns;
+    for (uint32 guid = 1; guid <= 6; ++guid)
+        spawns.ActivateObject<GameObject>(guid, PoolId);
+
+    // 4 inactive members are less than twice the count, so every inactive member is collected and 3 of them kept
+    std::vector<uint32> picks = CountPicks(pool, spawns, size, 3, rolls);
+
+    uint32 const expected = rolls * 3 / 4;
+    for (uint32 guid = 7; guid <= size; ++guid)
+    {
+        EXPECT_GT(picks[guid], expected * 95 / 100) << "guid " << guid;
+        EXPECT_LT(picks[guid], expected * 105 / 100) << "guid " << guid;
+    }
+}
+
+TEST(PoolMgrTest, RollEqualChancedReturnsAllInactiveWhenCountExceedsThem)
+{
+    PoolGroup<GameObject> pool;
+    FillPool(pool, 5);
+    ActivePoolData spawns;
+    spawns.ActivateObject<GameObject>(2, PoolId);
+    spawns.ActivateObject<GameObject>(4, PoolId);
+
+    std::vector<uint32> guids = Roll(pool, spawns, 5);
+    EXPECT_EQ(std::set<uint32>(guids.begin(), guids.end()), std::set<uint32>({ 1, 3, 5 }));
+    EXPECT_EQ(guids.size(), 3u);
+}
+
+TEST(PoolMgrTest, RollEqualChancedOnFullyActivePoolRollsNothing)
+{
+    PoolGroup<GameObject> pool;
+    FillPool(pool, 3);
+    ActivePoolData spawns;
+    for (uint32 guid = 1; guid <= 3; ++guid)
+        spawns.ActivateObject<GameObject>(guid, PoolId);
+
+    EXPECT_TRUE(Roll(pool, spawns, 1).empty());
+}
@@ -0,0 +1,109 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldPacket.h"
+#include "WorldSocket.h"
+#include "gtest/gtest.h"
+#include <memory>
+#include <vector>
+
+namespace
+{
+    WorldPacket MakePacket(uint32 value)
+    {
+        WorldPacket packet(SMSG_NOTIFICATION, 4);
+        packet << value;
+        return packet;
+    }
+
+    uint32 ReadValue(WorldPacket const& packet)
+    {
+        return packet.read<uint32>(0);
+    }
+}
+
+TEST(WorldPacketTest, LazySharedPacketCopiesOnFirstUse)
+{
+    WorldPacket packet = MakePacket(1);
+    LazySharedWorldPacket lazy(&packet);
+
+    // nothing is copied before the first send, changes up to then are part of it
+    packet.put<uint32>(0, 2);
+
+    SharedWorldPacket const& shared = lazy.Get();
+    ASSERT_TRUE(shared);
+    EXPECT_NE(shared.get(), &packet);
+    EXPECT_EQ(shared->GetOpcode(), SMSG_NOTIFICATION);
+    EXPECT_EQ(ReadValue(*shared), 2u);
+
+    // later calls hand out the same copy instead of building a new one
+    packet.put<uint32>(0, 3);
+    EXPECT_EQ(lazy.Get().get(), shared.get());
+    EXPECT_EQ(ReadValue(*lazy.Get()), 2u);
+}
+
+TEST(WorldPacketTest, SharedPacketIsSharedAcrossReceivers)
+{
+    WorldPacket packet = MakePacket(42);
+    LazySharedWorldPacket lazy(&packet);
+
+    std::vector<std::unique_ptr<EncryptablePacket>> queued;
+    for (uint32 i = 0; i < 10; ++i)
+        queued.push_back(std::make_unique<EncryptablePacket>(lazy.Get(), i % 2 == 0));
+
+    // every socket queue holds the same payload, only the encryption flag is per receiver
+    for (uint32 i = 0; i < queued.size(); ++i)
+    {
+        EXPECT_EQ(&queued[i]->GetPacket(), lazy.Get().get());
+        EXPECT_EQ(queued[i]->NeedsEncryption(), i % 2 == 0);
+    }
+
+    EXPECT_EQ(lazy.Get().use_count(), long(queued.size() + 1));
+}
+
+TEST(WorldPacketTest, SharedPacketOutlivesSource)
+{
+    std::vector<std::unique_ptr<EncryptablePacket>> queued;
+
+    {
+        WorldPacket packet = MakePacket(7);
+        LazySharedWorldPacket lazy(&packet);
+        for (uint32 i = 0; i < 3; ++i)
+            queued.push_back(std::make_unique<EncryptablePacket>(lazy.Get(), true));
+    }
+
+    // the broadcast and its source packet are gone, queued sends still have the payload
+    for (std::unique_ptr<EncryptablePacket> const& encryptable : queued)
+    {
+        EXPECT_EQ(encryptable->GetPacket().GetOpcode(), SMSG_NOTIFICATION);
+        EXPECT_EQ(ReadValue(encryptable->GetPacket()), 7u);
+    }
+
+    // the payload is freed with the last queued send
+    std::weak_ptr<WorldPacket const> payload;
+    queued.clear();
+    {
+        WorldPacket packet = MakePacket(8);
+        LazySharedWorldPacket lazy(&packet);
+        payload = lazy.Get();
+        queued.push_back(std::make_unique<EncryptablePacket>(lazy.Get(), false));
+    }
+
+    EXPECT_FALSE(payload.expired());
+    queued.clear();
+    EXPECT_TRUE(payload.expired());
+}